@@ -0,0 +1,85 @@
+// Copyright (c) 2026, the Dart project authors.  Please see the AUTHORS file
+// for details. All rights reserved. Use of this source code is governed by a
+// BSD-style license that can be found in the LICENSE file.
+//
+// Measures BigInt multiplication and modular exponentiation for operand
+// sizes used in public key cryptography.
+
+import 'package:benchmark_harness/benchmark_harness.dart';
+
+// Global sink used to ensure that the results are not optimized.
+dynamic sink;
+
+BigInt generate(int bits, int seed) {
+  // A deterministic operand with all bits below [bits] roughly random.
+  var result = BigInt.from(seed);
+  final multiplier = BigInt.parse(
+    'd4cba13fac3ee22b996ff6856c27c1f6',
+    radix: 16,
+  );
+  while (result.bitLength < bits) {
+    result = (result << 64) ^ (result * multiplier);
+  }
+  final mask = (BigInt.one << bits) - BigInt.one;
+  return (result & mask) | (BigInt.one << (bits - 1));
+}
+
+class Multiply extends BenchmarkBase {
+  final BigInt a;
+  final BigInt b;
+
+  Multiply(int bits)
+    : a = generate(bits, 17),
+      b = generate(bits, 31),
+      super('BigIntMultiply.multiply.$bits');
+
+  @override
+  void run() {
+    for (int i = 0; i < 10; i++) {
+      sink = a * b;
+    }
+  }
+}
+
+class ModPow extends BenchmarkBase {
+  final BigInt base;
+  final BigInt exponent;
+  final BigInt modulus;
+
+  ModPow(int bits)
+    : base = generate(bits, 7),
+      exponent = BigInt.from(65537),
+      modulus = generate(bits, 11) | BigInt.one,
+      super('BigIntMultiply.modPow.$bits');
+
+  @override
+  void run() {
+    sink = base.modPow(exponent, modulus);
+  }
+}
+
+class ParseDecimal extends BenchmarkBase {
+  final String string;
+
+  ParseDecimal(int bits)
+    : string = generate(bits, 5).toString(),
+      super('BigIntMultiply.parseDecimal.$bits');
+
+  @override
+  void run() {
+    sink = BigInt.parse(string);
+  }
+}
+
+void main() {
+  final benchmarks = [
+    for (final bits in [1024, 2048, 4096, 16384]) ...[
+      Multiply(bits),
+      ModPow(bits),
+      ParseDecimal(bits),
+    ],
+  ];
+  for (final benchmark in benchmarks) {
+    benchmark.report();
+  }
+}
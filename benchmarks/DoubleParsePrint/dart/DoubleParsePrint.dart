@@ -0,0 +1,83 @@
+// Copyright (c) 2026, the Dart project authors.  Please see the AUTHORS file
+// for details. All rights reserved. Use of this source code is governed by a
+// BSD-style license that can be found in the LICENSE file.
+//
+// Measures performance of double.parse and double.toString on the kinds of
+// values found in number-heavy payloads: integral counters, short decimals
+// (metrics, prices, geo coordinates) and values needing all 17 digits.
+
+import 'dart:math' show Random;
+
+import 'package:benchmark_harness/benchmark_harness.dart';
+
+// Global sink used to ensure that the results are not optimized.
+dynamic sink;
+
+const int count = 1000;
+
+List<double> generateIntegral(Random random) => List<double>.generate(
+  count,
+  (_) => random.nextInt(1 << 32).toDouble(),
+);
+
+List<double> generateShort(Random random) => List<double>.generate(
+  count,
+  (_) => (random.nextInt(360000000) - 180000000) / 1000000,
+);
+
+List<double> generateFull(Random random) => List<double>.generate(
+  count,
+  (_) => random.nextDouble() * 1000,
+);
+
+class DoubleParse extends BenchmarkBase {
+  final List<String> strings;
+
+  DoubleParse(String name, List<double> values)
+    : strings = values.map((double d) => d.toString()).toList(),
+      super('DoubleParsePrint.parse.$name');
+
+  @override
+  void run() {
+    double sum = 0;
+    for (final s in strings) {
+      sum += double.parse(s);
+    }
+    sink = sum;
+  }
+}
+
+class DoublePrint extends BenchmarkBase {
+  final List<double> values;
+
+  DoublePrint(String name, this.values)
+    : super('DoubleParsePrint.print.$name');
+
+  @override
+  void run() {
+    int length = 0;
+    for (final d in values) {
+      length += d.toString().length;
+    }
+    sink = length;
+  }
+}
+
+void main() {
+  final random = Random(42);
+  final integral = generateIntegral(random);
+  final short = generateShort(random);
+  final full = generateFull(random);
+
+  final benchmarks = [
+    DoubleParse('integral', integral),
+    DoubleParse('short', short),
+    DoubleParse('full', full),
+    DoublePrint('integral', integral),
+    DoublePrint('short', short),
+    DoublePrint('full', full),
+  ];
+  for (final benchmark in benchmarks) {
+    benchmark.report();
+  }
+}
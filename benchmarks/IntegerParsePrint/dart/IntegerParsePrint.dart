@@ -0,0 +1,72 @@
+// Copyright (c) 2026, the Dart project authors.  Please see the AUTHORS file
+// for details. All rights reserved. Use of this source code is governed by a
+// BSD-style license that can be found in the LICENSE file.
+//
+// Measures performance of int.parse and int.toString for integers of various
+// magnitudes, as found in log formatting and CSV processing.
+
+import 'dart:math' show Random;
+
+import 'package:benchmark_harness/benchmark_harness.dart';
+
+// Global sink used to ensure that the results are not optimized.
+dynamic sink;
+
+const int count = 1000;
+
+int generateOne(Random random, int digits) {
+  int value = 1 + random.nextInt(9);
+  for (int i = 1; i < digits; i++) {
+    value = value * 10 + random.nextInt(10);
+  }
+  return random.nextBool() ? value : -value;
+}
+
+List<int> generate(Random random, int digits) =>
+    List<int>.generate(count, (_) => generateOne(random, digits));
+
+class IntegerParse extends BenchmarkBase {
+  final List<String> strings;
+
+  IntegerParse(int digits, List<int> values)
+    : strings = values.map((int i) => i.toString()).toList(),
+      super('IntegerParsePrint.parse.$digits');
+
+  @override
+  void run() {
+    int sum = 0;
+    for (final s in strings) {
+      sum ^= int.parse(s);
+    }
+    sink = sum;
+  }
+}
+
+class IntegerPrint extends BenchmarkBase {
+  final List<int> values;
+
+  IntegerPrint(int digits, this.values)
+    : super('IntegerParsePrint.print.$digits');
+
+  @override
+  void run() {
+    int length = 0;
+    for (final i in values) {
+      length += i.toString().length;
+    }
+    sink = length;
+  }
+}
+
+void main() {
+  final random = Random(42);
+  final benchmarks = <BenchmarkBase>[];
+  for (final digits in [2, 6, 12, 18, 19]) {
+    final values = generate(random, digits);
+    benchmarks.add(IntegerParse(digits, values));
+    benchmarks.add(IntegerPrint(digits, values));
+  }
+  for (final benchmark in benchmarks) {
+    benchmark.report();
+  }
+}
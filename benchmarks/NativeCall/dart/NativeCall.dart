@@ -4,6 +4,7 @@
 
 // These micro benchmarks track the speed of native calls.
 
+import 'dart:developer';
 import 'dart:ffi';
 import 'dart:io';
 
@@ -304,6 +305,43 @@ class Handlex20 extends NativeCallBenchmarkBase {
   }
 }
 
+// Natives of the core libraries which are called once per measurement in
+// timing-sensitive code.
+
+class StopwatchElapsed extends NativeCallBenchmarkBase {
+  final Stopwatch stopwatch = Stopwatch()..start();
+
+  StopwatchElapsed() : super('NativeCall.StopwatchElapsed');
+
+  @override
+  void run() {
+    int previous = 0;
+    for (int i = 0; i < N; i++) {
+      final int ticks = stopwatch.elapsedTicks;
+      if (ticks < previous) {
+        throw Exception('$name: Clock went backwards');
+      }
+      previous = ticks;
+    }
+  }
+}
+
+class TimelineNow extends NativeCallBenchmarkBase {
+  TimelineNow() : super('NativeCall.TimelineNow');
+
+  @override
+  void run() {
+    int previous = 0;
+    for (int i = 0; i < N; i++) {
+      final int now = Timeline.now;
+      if (now < previous) {
+        throw Exception('$name: Clock went backwards');
+      }
+      previous = now;
+    }
+  }
+}
+
 //
 // Main driver.
 //
@@ -318,6 +356,8 @@ void main() {
     Doublex20.new,
     Handlex01.new,
     Handlex20.new,
+    StopwatchElapsed.new,
+    TimelineNow.new,
   ];
   for (final benchmark in benchmarks) {
     benchmark().report();
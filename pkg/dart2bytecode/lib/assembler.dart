@@ -439,6 +439,13 @@ class BytecodeAssembler {
     _emitJumpInstruction(Opcode.kJumpIfFalse, label);
   }
 
+  // Superinstruction for CompareIntLt followed by JumpIfFalse.
+  @pragma('vm:prefer-inline')
+  void emitJumpIfIntGe(Label label) {
+    emitSourcePosition();
+    _emitJumpInstruction(Opcode.kJumpIfIntGe, label);
+  }
+
   @pragma('vm:prefer-inline')
   void emitJumpIfNull(Label label) {
     _emitJumpInstruction(Opcode.kJumpIfNull, label);
@@ -1503,6 +1503,20 @@ class BytecodeGenerator extends RecursiveVisitor {
       if (done != null) {
         asm.bind(done);
       }
+    } else if (!value &&
+        options.emitSuperinstructions &&
+        condition is InstanceInvocationExpression &&
+        recognizedMethods.specializedBytecodeFor(condition) ==
+            Opcode.kCompareIntLt) {
+      // CompareIntLt followed by JumpIfFalse is the most frequent pair of
+      // bytecodes in loops (as reported by --interpreter_print_bytecode_pairs),
+      // so it is emitted as a single JumpIfIntGe.
+      _generateNode(condition.receiver);
+      _generateNode(condition.arguments.positional.single);
+      final savedSourcePosition = asm.currentSourcePosition;
+      _recordSourcePosition(condition.fileOffset);
+      asm.emitJumpIfIntGe(dest);
+      asm.currentSourcePosition = savedSourcePosition;
     } else {
       bool negated = _genCondition(condition);
       if (negated) {
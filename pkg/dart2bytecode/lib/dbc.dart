@@ -213,6 +213,10 @@ enum Opcode {
   kAllocateRecord_Wide,
   kLoadRecordField,
   kLoadRecordField_Wide,
+
+  // Superinstructions.
+  kJumpIfIntGe,
+  kJumpIfIntGe_Wide,
 }
 
 /// Compact variants of opcodes are always even.
@@ -462,6 +466,8 @@ const Map<Opcode, Format> BytecodeFormats = const {
       Encoding.kD, const [Operand.lit, Operand.none, Operand.none]),
   Opcode.kLoadRecordField: const Format(
       Encoding.kD, const [Operand.imm, Operand.none, Operand.none]),
+  Opcode.kJumpIfIntGe: const Format(
+      Encoding.kT, const [Operand.tgt, Operand.none, Operand.none]),
 };
 
 // Should match constant in runtime/vm/stack_frame_kbc.h.
@@ -13,6 +13,9 @@ class BytecodeOptions {
     'instance-field-initializers': 'Emit separate instance field initializers',
     'keep-unreachable-code':
         'Do not remove unreachable code (useful if collecting code coverage)',
+    'superinstructions':
+        'Fuse frequent bytecode pairs (CompareIntLt + JumpIfFalse) into a '
+            'single instruction',
   };
 
   bool enableAsserts;
@@ -23,6 +26,7 @@ class BytecodeOptions {
   bool emitInstanceFieldInitializers;
   bool omitAssertSourcePositions;
   bool keepUnreachableCode;
+  bool emitSuperinstructions;
   bool showBytecodeSizeStatistics;
 
   BytecodeOptions({
@@ -34,6 +38,7 @@ class BytecodeOptions {
     this.emitInstanceFieldInitializers = false,
     this.omitAssertSourcePositions = false,
     this.keepUnreachableCode = false,
+    this.emitSuperinstructions = false,
     this.showBytecodeSizeStatistics = false,
   }) {}
 
@@ -61,6 +66,9 @@ class BytecodeOptions {
         case 'keep-unreachable-code':
           keepUnreachableCode = true;
           break;
+        case 'superinstructions':
+          emitSuperinstructions = true;
+          break;
         case 'show-bytecode-size-stat':
           showBytecodeSizeStatistics = true;
           break;
@@ -30,7 +30,8 @@ const kUpdateExpectations = 'updateExpectations';
 
 final String dartSdkPkgDir = Platform.script.resolve('../..').toFilePath();
 
-runTestCase(Uri source) async {
+runTestCase(Uri source,
+    {BytecodeOptions? options, String expectFilePostfix = ''}) async {
   final target = VmTarget(TargetFlags());
   Component component =
       await compileTestCaseToKernelProgram(source, target: target);
@@ -41,7 +42,7 @@ runTestCase(Uri source) async {
 
   final sink = ByteSink();
   generateBytecode(component, sink,
-      options: BytecodeOptions(),
+      options: options ?? BytecodeOptions(),
       libraries: [mainLibrary],
       coreTypes: coreTypes,
       hierarchy: hierarchy,
@@ -54,7 +55,8 @@ runTestCase(Uri source) async {
   actual = actual.replaceAll(
       new Uri.file(dartSdkPkgDir).toString(), 'DART_SDK/pkg/');
 
-  compareResultWithExpectationsFile(source, actual);
+  compareResultWithExpectationsFile(source, actual,
+      expectFilePostfix: expectFilePostfix);
 }
 
 Future<Component> compileTestCaseToKernelProgram(Uri sourceUri,
@@ -157,5 +159,11 @@ main() {
         test(entry.path, () => runTestCase(entry.uri));
       }
     }
+
+    final loops = Uri.directory(testCasesDir.path).resolve('loops.dart');
+    test('${loops.toFilePath()} (superinstructions)',
+        () => runTestCase(loops,
+            options: BytecodeOptions(emitSuperinstructions: true),
+            expectFilePostfix: '.superinstructions'));
   });
 }
@@ -2295,6 +2295,27 @@ DART_EXPORT Dart_Handle Dart_NewStringFromCString(const char* str);
 DART_EXPORT Dart_Handle Dart_NewStringFromUTF8(const uint8_t* utf8_array,
                                                intptr_t length);
 
+/**
+ * Returns a List of Strings built from arrays of UTF-8 encoded characters.
+ *
+ * This is equivalent to calling Dart_NewStringFromUTF8 once per string and
+ * storing the results in a new List, but needs only a single transition into
+ * the VM and a single local handle, which matters when an embedder passes
+ * many strings to Dart at once.
+ *
+ * \param utf8_arrays An array of 'count' pointers to UTF-8 encoded
+ *   characters.
+ * \param lengths An array of 'count' lengths of the utf8_arrays.
+ * \param count The number of strings to create.
+ *
+ * \return The List object if no error occurs. Otherwise returns
+ *   an error handle.
+ */
+DART_EXPORT Dart_Handle
+Dart_NewListOfStringsFromUTF8(const uint8_t* const* utf8_arrays,
+                              const intptr_t* lengths,
+                              intptr_t count);
+
 /**
  * Returns a String built from an array of UTF-16 encoded characters.
  *
@@ -2863,6 +2884,68 @@ Dart_InvokeClosure(Dart_Handle closure,
                    int number_of_arguments,
                    Dart_Handle* arguments);
 
+/**
+ * A prepared invocation of a closure with a fixed number of positional
+ * arguments, for embedders which call the same closure many times.
+ */
+typedef struct _Dart_ClosureInvocation* Dart_ClosureInvocation;
+
+/**
+ * Prepares repeated invocations of a closure.
+ *
+ * The function the closure resolves to, the arguments descriptor and the
+ * arguments array are computed once here and reused by every call to
+ * Dart_InvokeClosureInvocation, which then neither allocates nor looks up
+ * anything before entering Dart code. If 'closure' is a callable object
+ * rather than a Closure, its call getter is invoked here, once.
+ *
+ * The invocation holds on to the closure and to the last arguments it was
+ * called with until it is deleted with Dart_DeleteClosureInvocation. It may
+ * only be used in the current isolate.
+ *
+ * \param closure A callable object.
+ * \param number_of_arguments The number of positional arguments every
+ *   invocation passes.
+ * \param invocation Returns the prepared invocation.
+ *
+ * \return A valid handle if no error occurs. Otherwise returns an error
+ *   handle, and 'invocation' is not set.
+ */
+DART_EXPORT DART_API_WARN_UNUSED_RESULT Dart_Handle
+Dart_NewClosureInvocation(Dart_Handle closure,
+                          int number_of_arguments,
+                          Dart_ClosureInvocation* invocation);
+
+/**
+ * Invokes a closure prepared with Dart_NewClosureInvocation.
+ *
+ * May generate an unhandled exception error.
+ *
+ * \param invocation A prepared invocation.
+ * \param arguments An array of as many arguments as the invocation was
+ *   prepared for, or NULL to pass the arguments of the previous call again
+ *   (null values before the first call).
+ *
+ * \return If no error occurs during execution, then the result of
+ *   invoking the closure is returned. If an error occurs during
+ *   execution, then an error handle is returned.
+ */
+DART_EXPORT DART_API_WARN_UNUSED_RESULT Dart_Handle
+Dart_InvokeClosureInvocation(Dart_ClosureInvocation invocation,
+                             Dart_Handle* arguments);
+
+/**
+ * Deletes a prepared invocation, releasing the closure and arguments it
+ * holds on to.
+ *
+ * Requires there to be a current isolate group. Aborts if 'invocation' is
+ * null.
+ *
+ * \param invocation A prepared invocation.
+ */
+DART_EXPORT void Dart_DeleteClosureInvocation(
+    Dart_ClosureInvocation invocation);
+
 /**
  * Invokes a Generative Constructor on an object that was previously
  * allocated using Dart_Allocate/Dart_AllocateWithNativeFields.
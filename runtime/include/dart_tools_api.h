@@ -526,6 +526,14 @@ DART_EXPORT int64_t
 Dart_IsolateGroupHeapNewCapacityMetric(Dart_IsolateGroup group);  // Byte
 DART_EXPORT int64_t
 Dart_IsolateGroupHeapNewExternalMetric(Dart_IsolateGroup group);  // Byte
+DART_EXPORT int64_t
+Dart_IsolateCpuTimeMetric(Dart_Isolate isolate);  // Microsecond
+DART_EXPORT int64_t
+Dart_IsolateAllocatedBytesMetric(Dart_Isolate isolate);  // Byte
+DART_EXPORT int64_t
+Dart_IsolateMessagesHandledMetric(Dart_Isolate isolate);  // Counter
+DART_EXPORT int64_t
+Dart_IsolateMessageLatencyMetric(Dart_Isolate isolate);  // Microsecond
 
 /*
  * ========
@@ -14,6 +14,7 @@
 #include "vm/object.h"
 #include "vm/object_store.h"
 #include "vm/resolver.h"
+#include "vm/safepoint_poll_page.h"
 #include "vm/stack_frame.h"
 #include "vm/symbols.h"
 
@@ -333,6 +334,10 @@ DEFINE_NATIVE_ENTRY(Internal_allocateObjectInstructionsEnd, 0, 0) {
   return Smi::New((stub.PayloadStart() - instructions_start) + stub.Size());
 }
 
+DEFINE_NATIVE_ENTRY(Internal_safepointPollFaultCount, 0, 0) {
+  return Integer::New(SafepointPollPage::handled_faults());
+}
+
 static bool ExtractInterfaceTypeArgs(Zone* zone,
                                      const Class& instance_cls,
                                      const TypeArguments& instance_type_args,
@@ -9,12 +9,14 @@
 
 namespace dart {
 
-DEFINE_NATIVE_ENTRY(Stopwatch_now, 0, 0) {
-  return Integer::New(OS::GetCurrentMonotonicTicks());
+// Leaf natives: called directly from Dart without a transition out of
+// generated code, so they must not allocate or touch the heap.
+DEFINE_FFI_NATIVE_ENTRY(Stopwatch_now, int64_t, ()) {
+  return OS::GetCurrentMonotonicTicks();
 }
 
-DEFINE_NATIVE_ENTRY(Stopwatch_frequency, 0, 0) {
-  return Integer::New(OS::GetCurrentMonotonicFrequency());
+DEFINE_FFI_NATIVE_ENTRY(Stopwatch_frequency, int64_t, ()) {
+  return OS::GetCurrentMonotonicFrequency();
 }
 
 }  // namespace dart
@@ -32,8 +32,9 @@ DEFINE_NATIVE_ENTRY(Timeline_getNextTaskId, 0, 0) {
 #endif
 }
 
-DEFINE_NATIVE_ENTRY(Timeline_getTraceClock, 0, 0) {
-  return Integer::New(OS::GetCurrentMonotonicMicros(), Heap::kNew);
+// Leaf native, must not allocate.
+DEFINE_FFI_NATIVE_ENTRY(Timeline_getTraceClock, int64_t, ()) {
+  return OS::GetCurrentMonotonicMicros();
 }
 
 DEFINE_NATIVE_ENTRY(Timeline_reportTaskEvent, 0, 5) {
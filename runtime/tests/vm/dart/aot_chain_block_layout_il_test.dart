@@ -0,0 +1,129 @@
+// Copyright (c) 2026, the Dart project authors.  Please see the AUTHORS file
+// for details. All rights reserved. Use of this source code is governed by a
+// BSD-style license that can be found in the LICENSE file.
+
+// Checks that functions whose blocks were laid out from static branch
+// heuristics still take the right paths: throwing and rarely called paths,
+// null checks, loop exits and catch blocks. Also checks that blocks calling
+// an unlikely function are placed after the likely path.
+
+// VMOptions=--aot-chain-block-layout
+
+import 'package:expect/expect.dart';
+import 'package:vm/testing/il_matchers.dart';
+
+int rareCalls = 0;
+
+@pragma('vm:never-inline')
+@pragma('vm:unlikely')
+void rare(int i) {
+  rareCalls++;
+}
+
+@pragma('vm:never-inline')
+@pragma('vm:testing:print-flow-graph', 'ReorderBlocks')
+int checked(List<int> list, int i) {
+  if (i < 0) throw ArgumentError.value(i);
+  if (i >= list.length) {
+    rare(i);
+    return -1;
+  }
+  return list[i];
+}
+
+@pragma('vm:never-inline')
+int nullable(int? x, int? y) {
+  if (x == null) return y ?? -1;
+  if (y != null) return x + y;
+  return x;
+}
+
+@pragma('vm:never-inline')
+int nested(int n) {
+  int result = 0;
+  for (int i = 0; i < n; i++) {
+    for (int j = 0; j < i; j++) {
+      if (j == 7) break;
+      if ((i ^ j) == 5) {
+        rare(j);
+        continue;
+      }
+      result += i * j;
+    }
+    if (i > 40) return -result;
+  }
+  return result;
+}
+
+@pragma('vm:never-inline')
+int caught(List<int> list, int i) {
+  int result = 0;
+  for (int j = 0; j < 3; j++) {
+    try {
+      result += checked(list, i - j);
+    } on ArgumentError {
+      result += 100;
+    }
+  }
+  return result;
+}
+
+int expectedNested(int n) {
+  int result = 0;
+  for (int i = 0; i < n; i++) {
+    for (int j = 0; j < i && j != 7; j++) {
+      if ((i ^ j) != 5) result += i * j;
+    }
+    if (i > 40) return -result;
+  }
+  return result;
+}
+
+main() {
+  final list = List<int>.generate(10, (i) => i * i);
+  for (int round = 0; round < 100; round++) {
+    rareCalls = 0;
+    Expect.equals(16, checked(list, 4));
+    Expect.equals(-1, checked(list, 10));
+    Expect.equals(1, rareCalls);
+    Expect.throws<ArgumentError>(() => checked(list, -1));
+
+    Expect.equals(-1, nullable(null, null));
+    Expect.equals(2, nullable(null, 2));
+    Expect.equals(3, nullable(3, null));
+    Expect.equals(5, nullable(3, 2));
+
+    for (final n in [0, 1, 6, 9, 20, 41, 42, 50]) {
+      Expect.equals(expectedNested(n), nested(n));
+    }
+
+    Expect.equals(81 + 64 + 49, caught(list, 9));
+    Expect.equals(1 + 0 + 100, caught(list, 1));
+    Expect.equals(-1 + 81 + 64, caught(list, 10));
+  }
+}
+
+bool _hasInstruction(dynamic block, bool Function(dynamic) test) =>
+    [...?block['is']].any(test);
+
+bool _isCallToRare(FlowGraph graph, dynamic instr) =>
+    instr['o'] == 'StaticCall' &&
+    ((graph.attributesFor(instr)?['function'] as String?)?.endsWith('rare') ??
+        false);
+
+void matchIL$checked(FlowGraph graph) {
+  graph.dump(inCodegenBlockOrder: true);
+  final blocks = graph.blocks(inCodegenBlockOrder: true);
+  final likely = blocks.indexWhere((block) =>
+      _hasInstruction(block, (instr) => instr['o'] == 'LoadIndexed') &&
+      _hasInstruction(block, (instr) => instr['o'] == 'DartReturn'));
+  final unlikely = blocks.indexWhere((block) =>
+      _hasInstruction(block, (instr) => _isCallToRare(graph, instr)));
+  final throwing = blocks.indexWhere(
+      (block) => _hasInstruction(block, (instr) => instr['o'] == 'Throw'));
+  Expect.notEquals(-1, likely);
+  Expect.notEquals(-1, unlikely);
+  Expect.notEquals(-1, throwing);
+  Expect.isTrue(likely < unlikely);
+  Expect.isTrue(likely < throwing);
+}
@@ -0,0 +1,25 @@
+// Copyright (c) 2026, the Dart project authors.  Please see the AUTHORS file
+// for details. All rights reserved. Use of this source code is governed by a
+// BSD-style license that can be found in the LICENSE file.
+
+// Program run by aot_coverage_bitmap_test.dart.
+
+@pragma('vm:never-inline')
+int called(int x) {
+  if (x > 0) {
+    return x;
+  }
+  return -x;
+}
+
+@pragma('vm:never-inline')
+int uncalled(int x) => x * 2;
+
+int unused(int x) => x * 3;
+
+main(List<String> args) {
+  print(called(args.length + 1));
+  if (args.length > 10) {
+    print(uncalled(args.length));
+  }
+}
@@ -0,0 +1,159 @@
+// Copyright (c) 2026, the Dart project authors.  Please see the AUTHORS file
+// for details. All rights reserved. Use of this source code is governed by a
+// BSD-style license that can be found in the LICENSE file.
+
+// Checks that code precompiled with --aot-coverage records coverage which the
+// precompiled runtime writes out for --write_coverage_bitmap_to, including
+// records without positions for functions which were never compiled.
+
+// OtherResources=aot_coverage_bitmap_program.dart
+
+import "dart:io";
+import "dart:typed_data";
+
+import 'package:expect/expect.dart';
+import 'package:path/path.dart' as path;
+
+import 'use_flag_test_helper.dart';
+
+class FunctionCoverage {
+  final int start;
+  final int end;
+  final int positions;
+  final int hits;
+
+  FunctionCoverage(this.start, this.end, this.positions, this.hits);
+}
+
+class Reader {
+  final Uint8List data;
+  int offset = 0;
+
+  Reader(this.data);
+
+  int readByte() => data[offset++];
+
+  int readLEB128() {
+    var result = 0;
+    var shift = 0;
+    while (true) {
+      final byte = readByte();
+      result |= (byte & 0x7f) << shift;
+      shift += 7;
+      if (byte & 0x80 == 0) return result;
+    }
+  }
+}
+
+// Returns the functions of the scripts in [bitmap] whose url ends in
+// [suffix].
+List<FunctionCoverage> readFunctions(Uint8List bitmap, String suffix) {
+  final reader = Reader(bitmap);
+  Expect.equals('DCOV', String.fromCharCodes(bitmap.sublist(0, 4)));
+  reader.offset = 4;
+  Expect.equals(1, reader.readLEB128());
+  final result = <FunctionCoverage>[];
+  final scriptCount = reader.readLEB128();
+  for (var i = 0; i < scriptCount; i++) {
+    final urlLength = reader.readLEB128();
+    final url = String.fromCharCodes(
+        bitmap.sublist(reader.offset, reader.offset + urlLength));
+    reader.offset += urlLength;
+    final functionCount = reader.readLEB128();
+    for (var j = 0; j < functionCount; j++) {
+      final start = reader.readLEB128();
+      final end = start + reader.readLEB128();
+      final count = reader.readLEB128();
+      for (var k = 0; k < count; k++) {
+        reader.readLEB128();
+      }
+      var hits = 0;
+      for (var k = 0; k < (count + 7) ~/ 8; k++) {
+        var bits = reader.readByte();
+        for (; bits != 0; bits >>= 1) {
+          hits += bits & 1;
+        }
+      }
+      if (url.endsWith(suffix)) {
+        result.add(FunctionCoverage(start, end, count, hits));
+      }
+    }
+  }
+  Expect.equals(bitmap.length, reader.offset);
+  return result;
+}
+
+// The function declared as `int [name](` in [source].
+FunctionCoverage functionNamed(
+    List<FunctionCoverage> functions, String source, String name) {
+  final offset = source.indexOf('int $name(') + 'int '.length;
+  return functions.singleWhere((f) => f.start <= offset && offset <= f.end);
+}
+
+main(List<String> args) async {
+  if (!isAOTRuntime) {
+    return; // Running in JIT: AOT binaries not available.
+  }
+
+  if (Platform.isAndroid) {
+    return; // SDK tree and dart_bootstrap not available on the test device.
+  }
+
+  // These are the tools we need to be available to run on a given platform:
+  if (!await testExecutable(genSnapshot)) {
+    throw "Cannot run test as $genSnapshot not available";
+  }
+  if (!await testExecutable(dartPrecompiledRuntime)) {
+    throw "Cannot run test as $dartPrecompiledRuntime not available";
+  }
+  if (!File(platformDill).existsSync()) {
+    throw "Cannot run test as $platformDill does not exist";
+  }
+
+  await withTempDir('aot-coverage-bitmap-test', (String tempDir) async {
+    final cwDir = path.dirname(Platform.script.toFilePath());
+    final script = path.join(cwDir, 'aot_coverage_bitmap_program.dart');
+    final scriptDill = path.join(tempDir, 'program.dill');
+    final snapshot = path.join(tempDir, 'program.so');
+    final prefix = path.join(tempDir, 'coverage');
+
+    await run(genKernel, <String>[
+      '--aot',
+      '--platform=$platformDill',
+      '-o',
+      scriptDill,
+      script,
+    ]);
+    await run(genSnapshot, <String>[
+      '--aot-coverage',
+      '--snapshot-kind=app-aot-elf',
+      '--elf=$snapshot',
+      scriptDill,
+    ]);
+    await run(dartPrecompiledRuntime, <String>[
+      '--write_coverage_bitmap_to=$prefix',
+      snapshot,
+    ]);
+
+    final bitmaps = Directory(tempDir)
+        .listSync()
+        .whereType<File>()
+        .where((f) => path.basename(f.path).startsWith('coverage.'))
+        .toList();
+    Expect.equals(1, bitmaps.length);
+    final functions = readFunctions(
+        bitmaps.single.readAsBytesSync(), 'aot_coverage_bitmap_program.dart');
+
+    final source = File(script).readAsStringSync();
+    final called = functionNamed(functions, source, 'called');
+    Expect.isTrue(called.hits > 0);
+    // The negative branch never ran.
+    Expect.isTrue(called.hits < called.positions);
+    final uncalled = functionNamed(functions, source, 'uncalled');
+    Expect.isTrue(uncalled.positions > 0);
+    Expect.equals(0, uncalled.hits);
+    // Never compiled, but still listed so that it counts as uncovered.
+    final unused = functionNamed(functions, source, 'unused');
+    Expect.equals(0, unused.positions);
+  });
+}
@@ -0,0 +1,202 @@
+// Copyright (c) 2026, the Dart project authors.  Please see the AUTHORS file
+// for details. All rights reserved. Use of this source code is governed by a
+// BSD-style license that can be found in the LICENSE file.
+
+// Checks that integer comparisons with zero which reuse the flags set by the
+// preceding arithmetic still branch the right way, including when the
+// compared value is not the result of that arithmetic and when control joins
+// in between. Also checks the disassembly of the equality comparisons for the
+// omitted comparison.
+
+// VMOptions=
+// VMOptions=--no-background-compilation --optimization-counter-threshold=100
+// VMOptions=--no-compare-to-zero-peephole
+
+import 'dart:io';
+
+import 'package:expect/expect.dart';
+
+import 'snapshot_test_helper.dart';
+
+@pragma('vm:never-inline')
+bool sumIsZero(int a, int b) => a + b == 0;
+
+@pragma('vm:never-inline')
+bool differenceIsNotZero(int a, int b) => a - b != 0;
+
+@pragma('vm:never-inline')
+bool maskIsZero(int a, int b) => (a & b) == 0;
+
+@pragma('vm:never-inline')
+bool xorIsZero(int a, int b) => (a ^ b) == 0;
+
+@pragma('vm:never-inline')
+bool orIsZero(int a, int b) => (a | b) == 0;
+
+@pragma('vm:never-inline')
+bool sumIsNegative(int a, int b) => a + b < 0;
+
+@pragma('vm:never-inline')
+bool differenceIsPositive(int a, int b) => a - b > 0;
+
+@pragma('vm:never-inline')
+bool otherIsZero(int a, int b) {
+  final sum = a + b;
+  return b == 0 && sum > 3;
+}
+
+@pragma('vm:never-inline')
+bool low32IsZero(int a, int b) => ((a + b) & 0xFFFFFFFF) == 0;
+
+@pragma('vm:never-inline')
+int countDown(int n) {
+  int steps = 0;
+  // The loop header joins the entry and the back edge, whose subtraction
+  // must not be mistaken for the one before the loop.
+  int i = n - 1;
+  while (i != 0) {
+    i = i - 1;
+    steps++;
+  }
+  return steps;
+}
+
+@pragma('vm:never-inline')
+int joined(int a, int b, bool first) {
+  int x;
+  if (first) {
+    x = a - b;
+  } else {
+    x = a + b;
+  }
+  return x == 0 ? 1 : 2;
+}
+
+void runChecks() {
+  const big = 0x100000000;
+  for (int i = 0; i < 300; i++) {
+    Expect.isTrue(sumIsZero(i, -i));
+    Expect.isFalse(sumIsZero(i, 1 - i));
+    Expect.isTrue(sumIsZero(big, -big));
+    Expect.isFalse(sumIsZero(big, 0));
+    Expect.isTrue(sumIsZero(0x8000000000000000, 0x8000000000000000));
+
+    Expect.isTrue(differenceIsNotZero(i, i + 1));
+    Expect.isFalse(differenceIsNotZero(i, i));
+    Expect.isTrue(differenceIsNotZero(big, 0));
+
+    Expect.isTrue(maskIsZero(i << 1, 1));
+    Expect.isFalse(maskIsZero(big | i, big));
+    Expect.isTrue(maskIsZero(big, 0xFFFFFFFF));
+
+    Expect.isTrue(xorIsZero(i, i));
+    Expect.isFalse(xorIsZero(i, i ^ big));
+
+    Expect.isTrue(orIsZero(0, 0));
+    Expect.isFalse(orIsZero(0, big));
+
+    // Overflowing arithmetic sets OF, which test would have cleared.
+    Expect.isTrue(sumIsNegative(-i - 1, 0));
+    Expect.isFalse(sumIsNegative(i, 0));
+    Expect.isTrue(sumIsNegative(0x7FFFFFFFFFFFFFFF, 1));
+    Expect.isFalse(differenceIsPositive(-i, 1));
+    Expect.isTrue(differenceIsPositive(i + 1, 0));
+    Expect.isTrue(differenceIsPositive(0x8000000000000000, 1));
+
+    Expect.isTrue(otherIsZero(i + 4, 0));
+    Expect.isFalse(otherIsZero(-i, -1));
+    Expect.isFalse(otherIsZero(0, 0));
+
+    Expect.isTrue(low32IsZero(big, 0));
+    Expect.isFalse(low32IsZero(big, 1));
+    Expect.isTrue(low32IsZero(0xFFFFFFFF, 1));
+
+    Expect.equals(i, countDown(i + 1));
+
+    Expect.equals(1, joined(i, i, true));
+    Expect.equals(i == 0 ? 1 : 2, joined(i, i, false));
+    Expect.equals(1, joined(i, -i, false));
+  }
+}
+
+const equalityFunctions = [
+  'sumIsZero',
+  'differenceIsNotZero',
+  'maskIsZero',
+  'xorIsZero',
+  'orIsZero',
+];
+
+final arithmeticPattern = RegExp(r'^(add|sub|and|or|xor)[lq] (\w+),');
+final zeroComparisonPattern = RegExp(r'^(test[lq] (\w+),\2|cmp[lq] (\w+),0)$');
+final flagsUsePattern = RegExp(r'^(j|set|cmov)n?z');
+
+// The instructions of the optimized code of each function, without addresses
+// and encodings.
+Map<String, List<String>> optimizedCode(String disassembly) {
+  final code = <String, List<String>>{};
+  List<String>? current;
+  for (final line in disassembly.split('\n')) {
+    if (line.startsWith('Code for optimized function')) {
+      final name = equalityFunctions
+          .firstWhere((name) => line.contains("_::_$name'"), orElse: () => '');
+      current = name.isEmpty ? null : (code[name] = <String>[]);
+    } else if (line.startsWith('}')) {
+      current = null;
+    } else if (current != null && line.startsWith('0x')) {
+      // Address, encoding, instruction.
+      final parts = line.trim().split(RegExp(r'\s+'));
+      current.add(parts.skip(2).join(' '));
+    }
+  }
+  return code;
+}
+
+Future<void> main(List<String> args) async {
+  runChecks();
+  if (args.contains('--child')) {
+    return;
+  }
+
+  if (!Platform.script.toString().endsWith(".dart")) {
+    return; // Not running from source: skip for app-jit and app-aot.
+  }
+  if (Platform.executable.contains("Product")) {
+    return; // No disassembler in product mode.
+  }
+  if (Platform.executableArguments.contains('--no-compare-to-zero-peephole')) {
+    return;
+  }
+
+  final result = await runDart(
+      'GENERATE DISASSEMBLY',
+      [
+        '--no-background-compilation',
+        '--optimization-counter-threshold=100',
+        '--disassemble-optimized',
+        '--print-flow-graph-filter=${equalityFunctions.join(',')}',
+        Platform.script.toFilePath(),
+        '--child',
+      ],
+      printOut: false);
+  final code = optimizedCode(
+      '${result.processResult.stdout}${result.processResult.stderr}');
+  Expect.setEquals(equalityFunctions, code.keys);
+
+  // == and != with zero reuse the ZF of the arithmetic computing the value.
+  int reused = 0;
+  code.forEach((name, instructions) {
+    for (int i = 0; i + 1 < instructions.length; i++) {
+      final arithmetic = arithmeticPattern.firstMatch(instructions[i]);
+      if (arithmetic == null) continue;
+      final next = instructions[i + 1];
+      final comparison = zeroComparisonPattern.firstMatch(next);
+      Expect.isFalse(
+          comparison != null &&
+              (comparison[2] ?? comparison[3]) == arithmetic[2],
+          '$name compares the result of ${instructions[i]} with zero');
+      if (flagsUsePattern.hasMatch(next)) reused++;
+    }
+  });
+  Expect.isTrue(reused > 0, 'No comparison with zero was omitted');
+}
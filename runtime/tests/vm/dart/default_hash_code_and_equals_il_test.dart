@@ -0,0 +1,71 @@
+// Copyright (c) 2026, the Dart project authors.  Please see the AUTHORS file
+// for details. All rights reserved. Use of this source code is governed by a
+// BSD-style license that can be found in the LICENSE file.
+
+// Verifies that the hashCode and == used by the default LinkedHashMap and
+// LinkedHashSet only make a dynamic call for keys which are neither
+// one-byte strings nor Smis.
+
+import 'dart:_internal' show defaultHashCode, defaultEquals;
+
+import 'package:expect/expect.dart';
+import 'package:vm/testing/il_matchers.dart';
+
+class Key {
+  final int id;
+  Key(this.id);
+
+  @override
+  int get hashCode => id;
+
+  @override
+  bool operator ==(Object other) => other is Key && other.id == id;
+}
+
+@pragma('vm:never-inline')
+@pragma('vm:testing:print-flow-graph')
+int hashOf(Object? key) => defaultHashCode(key);
+
+@pragma('vm:never-inline')
+@pragma('vm:testing:print-flow-graph')
+bool equal(Object? a, Object? b) => defaultEquals(a, b);
+
+void _expectSingleDynamicCall(FlowGraph graph) {
+  graph.dump();
+  var count = 0;
+  for (var block in graph.blocks()) {
+    for (var instr in [...?block['is']]) {
+      final op = instr['o'] as String;
+      if (op == 'DispatchTableCall' ||
+          op == 'InstanceCall' ||
+          op == 'PolymorphicInstanceCall') {
+        count++;
+      }
+    }
+  }
+  // Only the fallback for other keys calls through the selector.
+  if (count != 1) {
+    throw 'Expected a single dynamic call, found $count';
+  }
+}
+
+void matchIL$hashOf(FlowGraph graph) {
+  _expectSingleDynamicCall(graph);
+}
+
+void matchIL$equal(FlowGraph graph) {
+  _expectSingleDynamicCall(graph);
+}
+
+void main() {
+  final keys = <Object?>['abc', 'abcሴ', 42, 1 << 62, 1.5, Key(7), null];
+  for (final key in keys) {
+    Expect.equals(key.hashCode, hashOf(key));
+    Expect.isTrue(equal(key, key));
+    Expect.isFalse(equal(key, 'x'));
+  }
+  Expect.isTrue(equal('ab' + 'c', 'abc'));
+  Expect.isTrue(equal(1, 1.0));
+  Expect.isFalse(equal(1, '1'));
+  Expect.isTrue(equal(Key(3), Key(3)));
+}
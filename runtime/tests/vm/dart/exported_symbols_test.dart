@@ -86,6 +86,7 @@ main() {
     "Dart_DebugNameToCString",
     "Dart_DeferredLoadComplete",
     "Dart_DeferredLoadCompleteError",
+    "Dart_DeleteClosureInvocation",
     "Dart_DeleteFinalizableHandle",
     "Dart_DeletePersistentHandle",
     "Dart_DeleteWeakPersistentHandle",
@@ -160,6 +161,7 @@ main() {
     "Dart_IntegerToUint64",
     "Dart_Invoke",
     "Dart_InvokeClosure",
+    "Dart_InvokeClosureInvocation",
     "Dart_InvokeConstructor",
     "Dart_InvokeVMServiceMethod",
     "Dart_IsApiError",
@@ -183,6 +185,8 @@ main() {
     "Dart_IsNull",
     "Dart_IsNullableType",
     "Dart_IsNumber",
+    "Dart_IsolateAllocatedBytesMetric",
+    "Dart_IsolateCpuTimeMetric",
     "Dart_IsolateData",
     "Dart_IsolateFlagsInitialize",
     "Dart_IsolateGroupData",
@@ -193,6 +197,8 @@ main() {
     "Dart_IsolateGroupHeapOldExternalMetric",
     "Dart_IsolateGroupHeapOldUsedMetric",
     "Dart_IsolateMakeRunnable",
+    "Dart_IsolateMessageLatencyMetric",
+    "Dart_IsolateMessagesHandledMetric",
     "Dart_IsolateRunnableHeapSizeMetric",
     "Dart_IsolateRunnableLatencyMetric",
     "Dart_IsolateServiceId",
@@ -235,6 +241,7 @@ main() {
     "Dart_NewApiError",
     "Dart_NewBoolean",
     "Dart_NewByteBuffer",
+    "Dart_NewClosureInvocation",
     "Dart_NewCompilationError",
     "Dart_NewDouble",
     "Dart_NewExternalTypedData",
@@ -244,6 +251,7 @@ main() {
     "Dart_NewIntegerFromHexCString",
     "Dart_NewIntegerFromUint64",
     "Dart_NewList",
+    "Dart_NewListOfStringsFromUTF8",
     "Dart_NewListOfType",
     "Dart_NewListOfTypeFilled",
     "Dart_NewNativePort",
@@ -0,0 +1,18 @@
+// Copyright (c) 2026, the Dart project authors.  Please see the AUTHORS file
+// for details. All rights reserved. Use of this source code is governed by a
+// BSD-style license that can be found in the LICENSE file.
+
+// Program compiled by use_instructions_order_file_flag_test.dart.
+
+@pragma('vm:never-inline')
+int orderedFirst(int x) => x * 3;
+
+@pragma('vm:never-inline')
+int orderedSecond(int x) => x + 5;
+
+@pragma('vm:never-inline')
+int orderedThird(int x) => x ~/ 2;
+
+main(List<String> args) {
+  print(orderedThird(orderedSecond(orderedFirst(args.length + 1))));
+}
@@ -0,0 +1,53 @@
+// Copyright (c) 2026, the Dart project authors.  Please see the AUTHORS file
+// for details. All rights reserved. Use of this source code is governed by a
+// BSD-style license that can be found in the LICENSE file.
+
+// Verifies that --narrow-loop-bounds moves the bounds check on the index of
+// a counting loop from the loop body to the loop exit.
+
+// VMOptions=--narrow-loop-bounds
+
+import 'dart:typed_data';
+
+import 'package:expect/expect.dart';
+import 'package:vm/testing/il_matchers.dart';
+
+final List<int> seen = <int>[];
+
+@pragma('vm:never-inline')
+@pragma('vm:testing:print-flow-graph')
+int sumAndRecord(Int64List list, int start, int end) {
+  int result = 0;
+  for (int i = start; i < end; i++) {
+    final value = list[i];
+    seen.add(value);
+    result += value;
+  }
+  return result;
+}
+
+bool _hasInstruction(dynamic block, String op) =>
+    [...?block['is']].any((instr) => instr['o'] == op);
+
+void matchIL$sumAndRecord(FlowGraph graph) {
+  final blocks = graph.blocks();
+  final body = blocks.where((block) => _hasInstruction(block, 'LoadIndexed'));
+  final checks =
+      blocks.where((block) => _hasInstruction(block, 'GenericCheckBound'));
+  if (body.length != 1 ||
+      _hasInstruction(body.single, 'GenericCheckBound') ||
+      checks.isEmpty ||
+      !blocks.any((block) => _hasInstruction(block, 'MathMinMax'))) {
+    graph.dump();
+    throw 'bounds check was not moved out of the loop body';
+  }
+}
+
+main() {
+  final list = Int64List.fromList(List<int>.generate(10, (i) => i + 1));
+  Expect.equals(55, sumAndRecord(list, 0, 10));
+  Expect.equals(10, seen.length);
+  seen.clear();
+  Expect.throws<RangeError>(() => sumAndRecord(list, 8, 11));
+  Expect.listEquals([9, 10], seen);
+}
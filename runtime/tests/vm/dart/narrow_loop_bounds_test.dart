@@ -0,0 +1,74 @@
+// Copyright (c) 2026, the Dart project authors.  Please see the AUTHORS file
+// for details. All rights reserved. Use of this source code is governed by a
+// BSD-style license that can be found in the LICENSE file.
+
+// Checks that loops whose bounds checks were moved to the loop exit throw
+// the same RangeError after the same iterations as the original loops.
+
+// VMOptions=--narrow-loop-bounds
+
+import 'dart:typed_data';
+
+import 'package:expect/expect.dart';
+
+@pragma('vm:never-inline')
+int sum(Int64List list, int start, int end) {
+  int result = 0;
+  for (int i = start; i < end; i++) {
+    result += list[i];
+  }
+  return result;
+}
+
+final List<int> seen = <int>[];
+
+// The call to seen.add follows the index check, so the check can still be
+// moved to the loop exit.
+@pragma('vm:never-inline')
+int sumAndRecord(Int64List list, int start, int end) {
+  int result = 0;
+  int i = start;
+  for (; i < end; i++) {
+    final value = list[i];
+    seen.add(value);
+    result += value;
+  }
+  return result + i;
+}
+
+void expectRangeError(int index, int length, void Function() f) {
+  try {
+    f();
+  } on RangeError catch (e) {
+    Expect.equals(index, e.invalidValue);
+    Expect.equals(length - 1, e.end);
+    return;
+  }
+  Expect.fail('RangeError expected');
+}
+
+main() {
+  final list = Int64List.fromList(List<int>.generate(10, (i) => i + 1));
+  for (int round = 0; round < 100; round++) {
+    Expect.equals(55, sum(list, 0, 10));
+    Expect.equals(5 + 6 + 7, sum(list, 4, 7));
+    Expect.equals(0, sum(list, 7, 7));
+    Expect.equals(0, sum(list, 12, 3));
+    Expect.equals(0, sum(Int64List(0), 0, 0));
+    expectRangeError(10, 10, () => sum(list, 0, 11));
+    expectRangeError(10, 10, () => sum(list, 9, 1 << 40));
+    expectRangeError(12, 10, () => sum(list, 12, 13));
+    expectRangeError(0, 0, () => sum(Int64List(0), 0, 1));
+
+    seen.clear();
+    Expect.equals(55 + 10, sumAndRecord(list, 0, 10));
+    Expect.equals(10, seen.length);
+    Expect.equals(0 + 3, sumAndRecord(list, 3, 3));
+    Expect.equals(0 + 20, sumAndRecord(list, 20, 5));
+
+    seen.clear();
+    expectRangeError(10, 10, () => sumAndRecord(list, 7, 12));
+    // Iterations before the failing one have run.
+    Expect.listEquals([8, 9, 10], seen);
+  }
+}
@@ -0,0 +1,76 @@
+// Copyright (c) 2026, the Dart project authors.  Please see the AUTHORS file
+// for details. All rights reserved. Use of this source code is governed by a
+// BSD-style license that can be found in the LICENSE file.
+
+// Verifies that --partial-load-elimination leaves a single load of a field
+// on every path through a diamond and through a loop which stores to it.
+
+// VMOptions=--partial-load-elimination
+
+import 'package:expect/expect.dart';
+import 'package:vm/testing/il_matchers.dart';
+
+class Box {
+  int value;
+  Box(this.value);
+}
+
+@pragma('vm:never-inline')
+@pragma('vm:testing:print-flow-graph')
+int diamond(Box b, bool load) {
+  int x = 0;
+  if (load) {
+    x = b.value;
+  }
+  return x + b.value;
+}
+
+@pragma('vm:never-inline')
+@pragma('vm:testing:print-flow-graph')
+int loopCarried(Box b, int n) {
+  int sum = 0;
+  for (int i = 0; i < n; i++) {
+    sum += b.value;
+    b.value = i;
+  }
+  return sum;
+}
+
+bool _isValueLoad(FlowGraph graph, dynamic instr) =>
+    instr['o'] == 'LoadField' &&
+    graph.attributesFor(instr)?['slot'] == 'value';
+
+int _countValueLoads(FlowGraph graph, Iterable<dynamic> blocks) => [
+      for (var block in blocks)
+        for (var instr in [...?block['is']])
+          if (_isValueLoad(graph, instr)) instr
+    ].length;
+
+void matchIL$diamond(FlowGraph graph) {
+  graph.dump();
+  // One load on each side of the branch. The load after the join is
+  // replaced by a phi.
+  Expect.equals(2, _countValueLoads(graph, graph.blocks()));
+  final joins = graph.blocks().where((block) =>
+      [...?block['is']].any((instr) => instr['o'] == 'DartReturn'));
+  Expect.equals(0, _countValueLoads(graph, joins));
+}
+
+void matchIL$loopCarried(FlowGraph graph) {
+  graph.dump();
+  // The load in the loop is replaced by a phi of a single load before the
+  // loop and the value stored on the back edge.
+  Expect.equals(1, _countValueLoads(graph, graph.blocks()));
+}
+
+void main() {
+  for (int i = 0; i < 10; i++) {
+    final b = Box(i);
+    Expect.equals(2 * i, diamond(b, true));
+    Expect.equals(i, diamond(b, false));
+
+    final c = Box(100);
+    Expect.equals(136, loopCarried(c, 10));
+    Expect.equals(9, c.value);
+  }
+}
@@ -0,0 +1,128 @@
+// Copyright (c) 2026, the Dart project authors.  Please see the AUTHORS file
+// for details. All rights reserved. Use of this source code is governed by a
+// BSD-style license that can be found in the LICENSE file.
+
+// Checks that loads which are redundant along some of the paths reaching
+// them still observe the right values, including when the paths store to
+// the same or to possibly aliased places.
+
+// VMOptions=--partial-load-elimination
+// VMOptions=--partial-load-elimination --no-background-compilation --optimization-counter-threshold=100
+
+import 'dart:typed_data';
+
+import 'package:expect/expect.dart';
+
+class Box {
+  int value;
+  Box? next;
+  Box(this.value);
+}
+
+@pragma('vm:never-inline')
+int diamond(Box b, bool load) {
+  int x = 0;
+  if (load) {
+    x = b.value;
+  }
+  // b.value is only available on one of the paths here.
+  return x + b.value;
+}
+
+@pragma('vm:never-inline')
+int diamondWithStore(Box b, Box other, bool store) {
+  if (store) {
+    other.value = 7;
+  } else {
+    b.value += 1;
+  }
+  // other might be b.
+  return b.value;
+}
+
+@pragma('vm:never-inline')
+int loopCarried(Box b, int n) {
+  int sum = 0;
+  for (int i = 0; i < n; i++) {
+    sum += b.value;
+    b.value = i;
+  }
+  return sum;
+}
+
+@pragma('vm:never-inline')
+int loopCarriedAliased(Box b, Box c, int n) {
+  int sum = 0;
+  for (int i = 0; i < n; i++) {
+    sum += b.value;
+    b.value = i;
+    c.value = -i;
+  }
+  return sum;
+}
+
+@pragma('vm:never-inline')
+int loopChain(Box b, int n) {
+  int sum = 0;
+  Box? current = b;
+  for (int i = 0; i < n && current != null; i++) {
+    sum += current.value;
+    current = current.next;
+  }
+  return sum;
+}
+
+@pragma('vm:never-inline')
+double typedData(Float64List list, int i, bool load) {
+  double x = 0.0;
+  if (load) {
+    x = list[i];
+  } else {
+    list[i] = 2.5;
+  }
+  return x + list[i];
+}
+
+@pragma('vm:never-inline')
+int nullable(Box? b, bool check) {
+  int x = 0;
+  if (check && b != null) {
+    x = b.value;
+  }
+  return b == null ? x : x + b.value;
+}
+
+main() {
+  for (int i = 0; i < 300; i++) {
+    final b = Box(i);
+    Expect.equals(2 * i, diamond(b, true));
+    Expect.equals(i, diamond(b, false));
+
+    Expect.equals(i + 1, diamondWithStore(b, Box(0), false));
+    Expect.equals(7, diamondWithStore(b, b, true));
+    Expect.equals(7, diamondWithStore(b, Box(0), true));
+
+    final c = Box(100);
+    // 100 + 0 + 1 + ... + 8
+    Expect.equals(136, loopCarried(c, 10));
+    Expect.equals(9, c.value);
+
+    final d = Box(100);
+    Expect.equals(136, loopCarriedAliased(d, Box(0), 10));
+    Expect.equals(9 + 0 - 1 - 2 - 3 - 4, loopCarriedAliased(d, d, 6));
+
+    final chain = Box(1)..next = (Box(2)..next = Box(3));
+    Expect.equals(6, loopChain(chain, 10));
+    Expect.equals(3, loopChain(chain, 2));
+
+    final list = Float64List(4)..[1] = 1.5;
+    Expect.equals(3.0, typedData(list, 1, true));
+    Expect.equals(2.5, typedData(list, 1, false));
+    Expect.equals(2.5, list[1]);
+
+    final e = Box(i);
+    Expect.equals(2 * i, nullable(e, true));
+    Expect.equals(i, nullable(e, false));
+    Expect.equals(0, nullable(null, true));
+  }
+}
@@ -0,0 +1,137 @@
+// Copyright (c) 2026, the Dart project authors.  Please see the AUTHORS file
+// for details. All rights reserved. Use of this source code is governed by a
+// BSD-style license that can be found in the LICENSE file.
+
+// Checks that the range in the result summary of a callee removes the bounds
+// check on an index it returns, even though the caller is first compiled
+// before the callee. Also checks that callers compiled against result
+// summaries still observe the right values, including null and values at the
+// edges of the summarized ranges. Suspendable callees return a Future or
+// Iterable rather than the values in their return statements, so they must
+// not be summarized.
+
+// VMOptions=--precompiler-result-summaries
+
+import 'dart:typed_data';
+
+import 'package:expect/expect.dart';
+import 'package:vm/testing/il_matchers.dart';
+
+class A {
+  final int x;
+  A(this.x);
+}
+
+class B extends A {
+  B(int x) : super(x);
+}
+
+@pragma('vm:never-inline')
+int smallInt(int i) => i & 0xff;
+
+@pragma('vm:never-inline')
+int anyInt(int i) => i ^ 0x100;
+
+@pragma('vm:never-inline')
+int? maybeInt(int i) => i.isEven ? i : null;
+
+@pragma('vm:never-inline')
+A makeA(int i) => A(i);
+
+@pragma('vm:never-inline')
+A makeAOrB(int i) => i.isEven ? A(i) : B(i);
+
+@pragma('vm:never-inline')
+String? maybeString(int i) => i > 2 ? 'x$i' : null;
+
+@pragma('vm:never-inline')
+int clamp(int i) {
+  if (i < -3) return -3;
+  if (i > 1000) return 1000;
+  return i;
+}
+
+@pragma('vm:never-inline')
+Future<int> asyncSmallInt(int i) async => i & 0xff;
+
+@pragma('vm:never-inline')
+Iterable<int> smallInts(int i) sync* {
+  yield i & 0xff;
+}
+
+@pragma('vm:never-inline')
+@pragma('vm:testing:print-flow-graph')
+int storeSmallInt(int i) {
+  final table = Int64List(256);
+  table[smallInt(i)] = i;
+  return table[255];
+}
+
+@pragma('vm:never-inline')
+@pragma('vm:testing:print-flow-graph')
+int storeAnyInt(int i) {
+  final table = Int64List(256);
+  table[anyInt(i)] = i;
+  return table[255];
+}
+
+@pragma('vm:never-inline')
+Future<int> useAsync(int i) async {
+  final Object future = asyncSmallInt(i);
+  Expect.isTrue(future is Future<int>);
+  final Object ints = smallInts(i);
+  Expect.isTrue(ints is Iterable<int>);
+  return await (future as Future<int>) + (ints as Iterable<int>).single;
+}
+
+@pragma('vm:never-inline')
+int useAll(List<int> table, int i) {
+  int result = table[smallInt(i)];
+  result += maybeInt(i) ?? -1;
+  result += makeA(i).x;
+  result += makeAOrB(i) is B ? 1 : 0;
+  result += maybeString(i)?.length ?? 0;
+  result += clamp(i * 7);
+  return result;
+}
+
+bool _hasBoundsCheck(FlowGraph graph) => graph
+    .blocks()
+    .any((block) => [...?block['is']].any((instr) =>
+        instr['o'] == 'GenericCheckBound' || instr['o'] == 'CheckArrayBound'));
+
+void matchIL$storeSmallInt(FlowGraph graph) {
+  // smallInt returns values in [0, 255], so the index is always in range.
+  if (_hasBoundsCheck(graph)) {
+    graph.dump();
+    throw 'bounds check on the result of smallInt was not removed';
+  }
+}
+
+void matchIL$storeAnyInt(FlowGraph graph) {
+  // Without a range for the result of anyInt the check has to stay.
+  if (!_hasBoundsCheck(graph)) {
+    graph.dump();
+    throw 'bounds check on the result of anyInt was removed';
+  }
+}
+
+main() async {
+  Expect.equals(255, storeSmallInt(255));
+  Expect.equals(0, storeSmallInt(256));
+  Expect.equals(-1, storeSmallInt(-1));
+  Expect.equals(0x1ff, storeAnyInt(0x1ff));
+  Expect.throws<RangeError>(() => storeAnyInt(0));
+
+  final table = List<int>.generate(256, (i) => i * 2);
+  for (final i in [0, 1, 2, 3, 255, 256, 257, -1, -200, 1 << 40]) {
+    final expected = table[i & 0xff] +
+        (i.isEven ? i : -1) +
+        i +
+        (i.isEven ? 0 : 1) +
+        (i > 2 ? 'x$i'.length : 0) +
+        (i * 7 < -3 ? -3 : (i * 7 > 1000 ? 1000 : i * 7));
+    Expect.equals(expected, useAll(table, i));
+    Expect.equals(2 * (i & 0xff), await useAsync(i));
+  }
+}
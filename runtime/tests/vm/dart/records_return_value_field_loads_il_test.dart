@@ -0,0 +1,54 @@
+// Copyright (c) 2026, the Dart project authors.  Please see the AUTHORS file
+// for details. All rights reserved. Use of this source code is governed by a
+// BSD-style license that can be found in the LICENSE file.
+
+// Verifies that a record returned unboxed is not allocated by the caller when
+// it is only used through field loads, and still is when it escapes.
+
+import 'package:expect/expect.dart';
+import 'package:vm/testing/il_matchers.dart';
+
+@pragma('vm:never-inline')
+(int, String) getRecord(int x, String y) => (x, y);
+
+@pragma('vm:never-inline')
+@pragma('vm:testing:print-flow-graph', 'SelectRepresentations')
+int fieldsOnly(int x, String y) {
+  final r = getRecord(x, y);
+  return r.$1 + r.$2.length;
+}
+
+Object? escaped;
+
+@pragma('vm:never-inline')
+@pragma('vm:testing:print-flow-graph', 'SelectRepresentations')
+int escapes(int x, String y) {
+  final r = getRecord(x, y);
+  if (x > 0) escaped = r;
+  return r.$1 + r.$2.length;
+}
+
+bool _hasRecordAllocation(FlowGraph graph) => graph.blocks().any((block) =>
+    [...?block['is']].any((instr) => instr['o'] == 'AllocateSmallRecord'));
+
+void matchIL$fieldsOnly(FlowGraph graph) {
+  if (_hasRecordAllocation(graph)) {
+    graph.dump();
+    throw 'record used only through field loads was allocated';
+  }
+}
+
+void matchIL$escapes(FlowGraph graph) {
+  if (!_hasRecordAllocation(graph)) {
+    graph.dump();
+    throw 'escaping record was not allocated';
+  }
+}
+
+void main() {
+  Expect.equals(45, fieldsOnly(42, 'abc'));
+  Expect.equals(-2, escapes(-3, 'x'));
+  Expect.isNull(escaped);
+  Expect.equals(7, escapes(5, 'xy'));
+  Expect.equals((5, 'xy'), escaped);
+}
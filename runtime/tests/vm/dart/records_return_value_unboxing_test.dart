@@ -0,0 +1,89 @@
+// Copyright (c) 2026, the Dart project authors.  Please see the AUTHORS file
+// for details. All rights reserved. Use of this source code is governed by a
+// BSD-style license that can be found in the LICENSE file.
+
+// Checks that records returned unboxed from calls keep their values when
+// callers only read their fields, when they escape on some paths only and
+// when the callee throws.
+
+// VMOptions=--no-background-compilation --optimization-counter-threshold=100
+
+import 'package:expect/expect.dart';
+
+@pragma('vm:never-inline')
+(int, String) divide(int x, int y) {
+  if (y == 0) throw ArgumentError('division by zero');
+  return (x ~/ y, '${x % y}');
+}
+
+abstract class Shape {
+  ({double w, double h}) get size;
+}
+
+class Rect implements Shape {
+  final double w;
+  final double h;
+  Rect(this.w, this.h);
+
+  @pragma('vm:never-inline')
+  ({double w, double h}) get size => (w: w, h: h);
+}
+
+class Square implements Shape {
+  final double side;
+  Square(this.side);
+
+  @pragma('vm:never-inline')
+  ({double w, double h}) get size => (w: side, h: side);
+}
+
+final escaped = <Object>[];
+
+@pragma('vm:never-inline')
+int fieldsOnly(int x, int y) {
+  final r = divide(x, y);
+  return r.$1 + r.$2.length;
+}
+
+@pragma('vm:never-inline')
+int escapesSometimes(int x, int y) {
+  final r = divide(x, y);
+  if (r.$1 > 10) {
+    escaped.add(r);
+  }
+  return r.$1;
+}
+
+@pragma('vm:never-inline')
+int caught(int x, int y) {
+  try {
+    final (q, rem) = divide(x, y);
+    return q + int.parse(rem);
+  } on ArgumentError {
+    return -1;
+  }
+}
+
+@pragma('vm:never-inline')
+double area(Shape s) {
+  final size = s.size;
+  return size.w * size.h;
+}
+
+main() {
+  for (int i = 0; i < 500; i++) {
+    Expect.equals(i ~/ 3 + '${i % 3}'.length, fieldsOnly(i, 3));
+    Expect.equals(i ~/ 2, escapesSometimes(i, 2));
+    Expect.equals(i ~/ 7 + i % 7, caught(i, 7));
+    Expect.equals(-1, caught(i, 0));
+    Expect.throws<ArgumentError>(() => fieldsOnly(i, 0));
+    Expect.equals(i * 2.0, area(Rect(i.toDouble(), 2.0)));
+    Expect.equals(i * i * 1.0, area(Square(i.toDouble())));
+  }
+  Expect.equals(500 - 22, escaped.length);
+  for (final r in escaped) {
+    final (q, rem) = r as (int, String);
+    Expect.isTrue(q > 10);
+    Expect.isTrue(rem == '0' || rem == '1');
+  }
+}
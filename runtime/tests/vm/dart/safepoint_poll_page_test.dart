@@ -0,0 +1,73 @@
+// Copyright (c) 2026, the Dart project authors.  Please see the AUTHORS file
+// for details. All rights reserved. Use of this source code is governed by a
+// BSD-style license that can be found in the LICENSE file.
+
+// Checks that an isolate spinning in an optimized loop still reaches
+// safepoints, handles OOB messages and can be killed when loop interrupt
+// checks poll a guard page, and that the interrupts arrive through a fault on
+// that page.
+
+// VMOptions=--use_safepoint_poll_page
+// VMOptions=--use_safepoint_poll_page --no-background-compilation --optimization-counter-threshold=100
+
+import 'dart:_internal' show VMInternalsForTesting;
+import 'dart:isolate';
+
+import 'package:expect/async_helper.dart';
+import 'package:expect/expect.dart';
+
+@pragma('vm:never-inline')
+int spin(SendPort started) {
+  started.send('started');
+  int i = 0;
+  // Never terminates: only interrupts get the isolate out of here.
+  while (i >= 0) {
+    i = (i + 1) & 0x3fffffff;
+  }
+  return i;
+}
+
+void worker(SendPort started) {
+  spin(started);
+}
+
+List<Object> allocate() {
+  final list = <Object>[];
+  for (int i = 0; i < 100000; i++) {
+    list.add(List<int>.filled(10, i));
+    if (list.length > 1000) list.clear();
+  }
+  return list;
+}
+
+main() async {
+  asyncStart();
+  final started = ReceivePort();
+  final onExit = ReceivePort();
+  final isolate = await Isolate.spawn(worker, started.sendPort,
+      onExit: onExit.sendPort, errorsAreFatal: true);
+  await started.first;
+
+  // Ping is an OOB message handled on interrupt. Until the loop is optimized
+  // its interrupt checks compare against the stack limit, so keep pinging
+  // until one of them went through the poll page.
+  final faultsBefore = VMInternalsForTesting.safepointPollFaultCount();
+  while (VMInternalsForTesting.safepointPollFaultCount() == faultsBefore) {
+    final pong = ReceivePort();
+    isolate.ping(pong.sendPort, response: 'pong', priority: Isolate.immediate);
+    Expect.equals('pong', await pong.first);
+  }
+
+  // Scavenges and mark-sweeps need the spinning isolate at a safepoint.
+  for (int i = 0; i < 20; i++) {
+    Expect.isTrue(allocate().length <= 1000);
+  }
+
+  final pong = ReceivePort();
+  isolate.ping(pong.sendPort, response: 'pong', priority: Isolate.immediate);
+  Expect.equals('pong', await pong.first);
+
+  isolate.kill(priority: Isolate.immediate);
+  await onExit.first;
+  asyncEnd();
+}
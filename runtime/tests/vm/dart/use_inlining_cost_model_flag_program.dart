@@ -0,0 +1,104 @@
+// Copyright (c) 2026, the Dart project authors.  Please see the AUTHORS file
+// for details. All rights reserved. Use of this source code is governed by a
+// BSD-style license that can be found in the LICENSE file.
+
+// Calls functions of increasing size with freshly allocated arguments, so
+// that some of them are above --inlining-size-threshold but still worth
+// inlining under --inlining-cost-model.
+
+class Vec {
+  final int x;
+  final int y;
+  Vec(this.x, this.y);
+}
+
+int dot1(Vec a, Vec b) {
+  var r = a.x * b.x + a.y * b.y;
+  return r;
+}
+
+int dot2(Vec a, Vec b) {
+  var r = a.x * b.x + a.y * b.y;
+  r ^= (a.x - b.y) * 3;
+  return r;
+}
+
+int dot3(Vec a, Vec b) {
+  var r = a.x * b.x + a.y * b.y;
+  r ^= (a.x - b.y) * 3;
+  r += (a.y ^ b.x) + 4;
+  return r;
+}
+
+int dot4(Vec a, Vec b) {
+  var r = a.x * b.x + a.y * b.y;
+  r ^= (a.x - b.y) * 3;
+  r += (a.y ^ b.x) + 4;
+  r = (r * 5) & 0xffffffff;
+  return r;
+}
+
+int dot5(Vec a, Vec b) {
+  var r = a.x * b.x + a.y * b.y;
+  r ^= (a.x - b.y) * 3;
+  r += (a.y ^ b.x) + 4;
+  r = (r * 5) & 0xffffffff;
+  r -= (a.x | b.y) >> 5;
+  return r;
+}
+
+int dot6(Vec a, Vec b) {
+  var r = a.x * b.x + a.y * b.y;
+  r ^= (a.x - b.y) * 3;
+  r += (a.y ^ b.x) + 4;
+  r = (r * 5) & 0xffffffff;
+  r -= (a.x | b.y) >> 5;
+  r ^= (a.x - b.y) * 7;
+  return r;
+}
+
+int dot7(Vec a, Vec b) {
+  var r = a.x * b.x + a.y * b.y;
+  r ^= (a.x - b.y) * 3;
+  r += (a.y ^ b.x) + 4;
+  r = (r * 5) & 0xffffffff;
+  r -= (a.x | b.y) >> 5;
+  r ^= (a.x - b.y) * 7;
+  r += (a.y ^ b.x) + 8;
+  return r;
+}
+
+int dot8(Vec a, Vec b) {
+  var r = a.x * b.x + a.y * b.y;
+  r ^= (a.x - b.y) * 3;
+  r += (a.y ^ b.x) + 4;
+  r = (r * 5) & 0xffffffff;
+  r -= (a.x | b.y) >> 5;
+  r ^= (a.x - b.y) * 7;
+  r += (a.y ^ b.x) + 8;
+  r = (r * 9) & 0xffffffff;
+  return r;
+}
+
+void main() {
+  var sum = 0;
+  for (var i = 0; i < 1000; i++) {
+    sum += dot1(Vec(i, i + 1), Vec(i * 2, i - 1));
+    sum &= 0xffffffffffff;
+    sum += dot2(Vec(i, i + 2), Vec(i * 3, i - 2));
+    sum &= 0xffffffffffff;
+    sum += dot3(Vec(i, i + 3), Vec(i * 4, i - 3));
+    sum &= 0xffffffffffff;
+    sum += dot4(Vec(i, i + 4), Vec(i * 5, i - 4));
+    sum &= 0xffffffffffff;
+    sum += dot5(Vec(i, i + 5), Vec(i * 6, i - 5));
+    sum &= 0xffffffffffff;
+    sum += dot6(Vec(i, i + 6), Vec(i * 7, i - 6));
+    sum &= 0xffffffffffff;
+    sum += dot7(Vec(i, i + 7), Vec(i * 8, i - 7));
+    sum &= 0xffffffffffff;
+    sum += dot8(Vec(i, i + 8), Vec(i * 9, i - 8));
+    sum &= 0xffffffffffff;
+  }
+  print(sum);
+}
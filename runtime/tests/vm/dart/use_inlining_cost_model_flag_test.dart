@@ -0,0 +1,137 @@
+// Copyright (c) 2026, the Dart project authors.  Please see the AUTHORS file
+// for details. All rights reserved. Use of this source code is governed by a
+// BSD-style license that can be found in the LICENSE file.
+
+// This test ensures that --inlining-decisions-log-to writes valid JSON, that
+// --inlining-growth-budget limits how much --inlining-cost-model inlines and
+// that the resulting snapshots compute the same result.
+
+// OtherResources=use_inlining_cost_model_flag_program.dart
+
+import "dart:convert";
+import "dart:io";
+
+import 'package:expect/expect.dart';
+import 'package:path/path.dart' as path;
+
+import 'use_flag_test_helper.dart';
+
+main(List<String> args) async {
+  if (!isAOTRuntime) {
+    return; // Running in JIT: AOT binaries not available.
+  }
+
+  if (Platform.isAndroid) {
+    return; // SDK tree and dart_bootstrap not available on the test device.
+  }
+
+  // These are the tools we need to be available to run on a given platform:
+  if (!await testExecutable(genSnapshot)) {
+    throw "Cannot run test as $genSnapshot not available";
+  }
+  if (!await testExecutable(dartPrecompiledRuntime)) {
+    throw "Cannot run test as $dartPrecompiledRuntime not available";
+  }
+  if (!File(platformDill).existsSync()) {
+    throw "Cannot run test as $platformDill does not exist";
+  }
+
+  await withTempDir('inlining-cost-model-flag-test', (String tempDir) async {
+    final cwDir = path.dirname(Platform.script.toFilePath());
+    final script =
+        path.join(cwDir, 'use_inlining_cost_model_flag_program.dart');
+    final scriptDill = path.join(tempDir, 'flag_program.dill');
+
+    // Compile script to Kernel IR.
+    await run(genKernel, <String>[
+      '--aot',
+      '--platform=$platformDill',
+      '-o',
+      scriptDill,
+      script,
+    ]);
+
+    // The log is also written when the default heuristics decide.
+    final defaults = await compileAndRun(tempDir, scriptDill, <String>[]);
+    final noBudget = await compileAndRun(tempDir, scriptDill, <String>[
+      '--inlining-cost-model',
+      '--inlining-growth-budget=0',
+    ]);
+    final budget = await compileAndRun(tempDir, scriptDill, <String>[
+      '--inlining-cost-model',
+      '--inlining-growth-budget=30',
+    ]);
+
+    // Without a budget, callees above the size threshold only get inlined
+    // if that does not grow the program.
+    Expect.isTrue(noBudget.growth <= 0,
+        'growth ${noBudget.growth} exceeds a budget of 0');
+    Expect.isTrue(noBudget.inlined < budget.inlined,
+        'budget 0 inlined ${noBudget.inlined}, budget 30 ${budget.inlined}');
+    Expect.isTrue(noBudget.growth < budget.growth,
+        'budget 0 grew by ${noBudget.growth}, budget 30 by ${budget.growth}');
+    Expect.isTrue(budget.growth <= budget.callerSize * 30 ~/ 100,
+        'growth ${budget.growth} exceeds 30% of ${budget.callerSize}');
+
+    // Inlining decisions must not change what the program computes.
+    Expect.deepEquals(defaults.output, noBudget.output);
+    Expect.deepEquals(defaults.output, budget.output);
+  });
+}
+
+class InliningResult {
+  final int inlined;
+  final int growth;
+  final int callerSize;
+  final List<String> output;
+
+  InliningResult(this.inlined, this.growth, this.callerSize, this.output);
+}
+
+Future<InliningResult> compileAndRun(
+    String tempDir, String scriptDill, List<String> flags) async {
+  final logFile = path.join(tempDir, 'inlining.json');
+  final snapshot = path.join(tempDir, 'snapshot.so');
+  await run(genSnapshot, <String>[
+    ...flags,
+    '--inlining-decisions-log-to=$logFile',
+    '--snapshot-kind=app-aot-elf',
+    '--elf=$snapshot',
+    scriptDill,
+  ]);
+
+  final log = json.decode(await File(logFile).readAsString());
+  Expect.isTrue(log is Map, 'not a JSON object');
+  Expect.isTrue(log['callerSize'] is int, 'callerSize is not an int');
+  Expect.isTrue(log['inlinedGrowth'] is int, 'inlinedGrowth is not an int');
+  final decisions = log['decisions'];
+  Expect.isTrue(decisions is List, 'decisions is not a list');
+  Expect.isFalse((decisions as List).isEmpty, 'no inlining decisions');
+  var inlined = 0;
+  for (final o in decisions) {
+    Expect.isTrue(o is Map, 'decision is not an object');
+    final m = o as Map;
+    for (final key in ['caller', 'callee', 'call']) {
+      Expect.isTrue(m[key] is String, '$key field is not a string');
+    }
+    for (final key in [
+      'depth',
+      'size',
+      'callSites',
+      'constantArgs',
+      'sinkableAllocations',
+      'benefit',
+      'remainingBudget',
+    ]) {
+      Expect.isTrue(m[key] is int, '$key field is not an int');
+    }
+    Expect.isTrue(m['inlined'] is bool, 'inlined field is not a boolean');
+    if (m['inlined'] as bool) inlined++;
+  }
+  Expect.isTrue(inlined > 0, 'nothing was inlined');
+
+  final output = await runOutput(dartPrecompiledRuntime, <String>[snapshot]);
+  Expect.equals(1, output.length, 'unexpected output: $output');
+  return InliningResult(
+      inlined, log['inlinedGrowth'] as int, log['callerSize'] as int, output);
+}
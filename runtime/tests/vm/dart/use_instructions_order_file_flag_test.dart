@@ -0,0 +1,82 @@
+// Copyright (c) 2026, the Dart project authors.  Please see the AUTHORS file
+// for details. All rights reserved. Use of this source code is governed by a
+// BSD-style license that can be found in the LICENSE file.
+
+// This test ensures that --instructions-order-file lays out the listed
+// functions first and in the listed order, and that the snapshot still runs.
+
+// OtherResources=instructions_order_program.dart
+
+import 'dart:io';
+
+import 'package:expect/expect.dart';
+import 'package:native_stack_traces/elf.dart';
+import 'package:path/path.dart' as path;
+
+import 'use_flag_test_helper.dart';
+
+main(List<String> args) async {
+  if (!isAOTRuntime) {
+    return; // Running in JIT: AOT binaries not available.
+  }
+
+  // Only run this test on Linux for simplicity.
+  if (!Platform.isLinux) {
+    return;
+  }
+
+  // These are the tools we need to be available to run on a given platform:
+  if (!await testExecutable(genSnapshot)) {
+    throw "Cannot run test as $genSnapshot not available";
+  }
+  if (!await testExecutable(dartPrecompiledRuntime)) {
+    throw "Cannot run test as $dartPrecompiledRuntime not available";
+  }
+  if (!File(platformDill).existsSync()) {
+    throw "Cannot run test as $platformDill does not exist";
+  }
+
+  await withTempDir('instructions-order-file-flag-test', (
+    String tempDir,
+  ) async {
+    final cwDir = path.dirname(Platform.script.toFilePath());
+    final script = path.join(cwDir, 'instructions_order_program.dart');
+    final scriptDill = path.join(tempDir, 'flag_program.dill');
+
+    // Compile script to Kernel IR.
+    await run(genKernel, <String>[
+      '--aot',
+      '--platform=$platformDill',
+      '-o',
+      scriptDill,
+      script,
+    ]);
+
+    final order = ['orderedThird', 'orderedFirst', 'orderedSecond'];
+    final orderFile = path.join(tempDir, 'order.txt');
+    await File(orderFile).writeAsString(
+        ['# Hottest first.', ...order, '', 'doesNotExist'].join('\n'));
+
+    final snapshot = path.join(tempDir, 'snapshot.so');
+    await run(genSnapshot, <String>[
+      '--instructions-order-file=$orderFile',
+      '--snapshot-kind=app-aot-elf',
+      '--elf=$snapshot',
+      scriptDill,
+    ]);
+
+    final output = await runOutput(dartPrecompiledRuntime, [snapshot]);
+    Expect.listEquals(['4'], output);
+
+    final elf = Elf.fromFile(snapshot)!;
+    int addressOf(String name) =>
+        elf.staticSymbols.firstWhere((s) => s.name.startsWith(name)).value;
+    final addresses = order.map(addressOf).toList();
+    for (int i = 1; i < addresses.length; i++) {
+      Expect.isTrue(addresses[i - 1] < addresses[i],
+          '${order[i - 1]} is not laid out before ${order[i]}');
+    }
+    Expect.isTrue(addresses.last < addressOf('main'),
+        'listed functions are not laid out before main');
+  });
+}
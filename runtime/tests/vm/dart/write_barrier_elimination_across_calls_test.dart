@@ -0,0 +1,143 @@
+// Copyright (c) 2026, the Dart project authors.  Please see the AUTHORS file
+// for details. All rights reserved. Use of this source code is governed by a
+// BSD-style license that can be found in the LICENSE file.
+
+// Checks that stores into fresh objects whose barriers were eliminated across
+// calls keep the heap consistent while scavenges promote those objects,
+// including when the callees throw.
+//
+// With --inlining-cost-model and no growth budget, `widen` is inlined into the
+// `Checked` constructor while constructors are compiled for their instruction
+// counts, but not in the code written to the snapshot. Only the latter
+// decides whether calls to the constructor are GC-free.
+
+// VMOptions=--write-barrier-elimination-across-calls
+// VMOptions=--write-barrier-elimination-across-calls --verify-store-buffer --verify-after-gc
+// VMOptions=--write-barrier-elimination-across-calls --verify-store-buffer --verify-after-gc --inlining-cost-model --inlining-growth-budget=0
+
+import 'package:expect/expect.dart';
+
+class Box {
+  Object? a;
+  Object? b;
+  Box? next;
+}
+
+@pragma('vm:never-inline')
+int leaf(int x) => (x * 31) ^ (x >> 3);
+
+@pragma('vm:never-inline')
+int leafCallingLeaf(int x) => leaf(x) + leaf(x + 1);
+
+@pragma('vm:never-inline')
+int throwing(int? x) => x! + 1;
+
+@pragma('vm:never-inline')
+Box allocating(int i) => Box()..a = i;
+
+// Returns its result boxed unless inlined.
+Object widen(int x) {
+  x = (x * 0x100000001) ^ (x >> 7);
+  x = (x * 0x100000003) ^ (x >> 11);
+  x = (x * 0x100000005) ^ (x >> 13);
+  x = (x * 0x100000007) ^ (x >> 17);
+  x = (x * 0x100000009) ^ (x >> 19);
+  x = (x * 0x10000000b) ^ (x >> 23);
+  x = (x * 0x10000000d) ^ (x >> 29);
+  x = (x * 0x10000000f) ^ (x >> 31);
+  return x;
+}
+
+class Checked {
+  final bool positive;
+  Object? next;
+
+  @pragma('vm:never-inline')
+  Checked(int x) : positive = (widen(x) as int) > 0;
+}
+
+@pragma('vm:never-inline')
+Box storesAcrossLeaves(Box? previous, int i) {
+  final box = Box();
+  final x = leaf(i);
+  box.a = Box()..a = x;
+  final y = leafCallingLeaf(i);
+  box.b = Box()..b = y;
+  box.next = previous;
+  return box;
+}
+
+@pragma('vm:never-inline')
+Box storesAcrossAllocatingCall(Box? previous, int i) {
+  final box = Box();
+  box.a = allocating(i);
+  box.b = allocating(i + 1);
+  box.next = previous;
+  return box;
+}
+
+@pragma('vm:never-inline')
+Box storesAcrossThrowingCall(Box? previous, int? i) {
+  final box = Box();
+  try {
+    box.a = throwing(i);
+  } catch (_) {
+    box.a = Box()..a = -1;
+  }
+  box.b = [i, i];
+  box.next = previous;
+  return box;
+}
+
+@pragma('vm:never-inline')
+Box storesAcrossConstructor(Box? previous, int i) {
+  final checked = Checked(i);
+  checked.next = previous;
+  return Box()
+    ..a = checked
+    ..b = checked.positive
+    ..next = previous;
+}
+
+@pragma('vm:never-inline')
+List<Object?> arrayAcrossLeaf(int i) {
+  final list = List<Object?>.filled(4, null);
+  list[0] = Box()..a = leaf(i);
+  list[1] = Box()..a = leaf(i + 1);
+  list[2] = [leaf(i + 2)];
+  list[3] = list;
+  return list;
+}
+
+void main() {
+  Expect.equals(leaf(3) + leaf(4), leafCallingLeaf(3));
+  Expect.equals(2, throwing(1));
+  Expect.throws(() => throwing(null));
+
+  // Keep long chains alive so that scavenges promote them while the next
+  // stores happen.
+  Box? chain;
+  final arrays = <List<Object?>>[];
+  for (int i = 0; i < 200000; i++) {
+    chain = storesAcrossLeaves(chain, i);
+    chain = storesAcrossAllocatingCall(chain, i);
+    chain = storesAcrossThrowingCall(chain, i.isEven ? i : null);
+    chain = storesAcrossConstructor(chain, i);
+    if (i % 10 == 0) arrays.add(arrayAcrossLeaf(i));
+    if (i % 50000 == 0) chain = null;
+  }
+
+  int count = 0;
+  for (Box? box = chain; box != null; box = box.next, count++) {
+    Expect.isNotNull(box.a);
+    Expect.isNotNull(box.b);
+  }
+  Expect.equals(4 * 49999, count);
+  for (int i = 0; i < arrays.length; i++) {
+    final list = arrays[i];
+    Expect.equals(leaf(i * 10), (list[0] as Box).a);
+    Expect.equals(leaf(i * 10 + 1), (list[1] as Box).a);
+    Expect.equals(leaf(i * 10 + 2), (list[2] as List)[0]);
+    Expect.identical(list, list[3]);
+  }
+}
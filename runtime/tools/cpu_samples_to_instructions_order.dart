@@ -0,0 +1,115 @@
+// Copyright (c) 2026, the Dart project authors.  Please see the AUTHORS file
+// for details. All rights reserved. Use of this source code is governed by a
+// BSD-style license that can be found in the LICENSE file.
+//
+// Tool to compute an --instructions-order-file for gen_snapshot from CPU
+// samples, so that hot functions and the functions they call are laid out
+// next to each other in the instructions section of AOT snapshots.
+//
+// Save the response of the VM service getCpuSamples RPC to a file, then:
+//
+// dart cpu_samples_to_instructions_order.dart samples.json > order.txt
+// gen_snapshot --instructions-order-file=order.txt ...
+//
+// Functions are clustered along their hottest call edges: going from the
+// hottest function down, the cluster of each function is appended to the
+// cluster of its hottest caller unless that cluster grew too large. Clusters
+// are then printed hottest first, by samples per function.
+
+import 'dart:convert';
+import 'dart:io';
+
+const MAX_CLUSTER_SIZE = 64;
+
+class Cluster {
+  final List<int> functions;
+  int samples;
+  Cluster(int function, this.samples) : functions = <int>[function];
+  double get density => samples / functions.length;
+}
+
+String? nameOf(Map<String, dynamic> function) {
+  if (function['type'] != '@Function') return null;
+  final owner = function['owner'] as Map<String, dynamic>?;
+  final name = function['name'] as String;
+  switch (owner?['type']) {
+    case '@Class':
+      return '${owner!['name']}.$name';
+    case '@Function':
+      final ownerName = nameOf(owner!);
+      return ownerName == null ? name : '$ownerName.$name';
+    default:
+      return name;
+  }
+}
+
+main(List<String> args) {
+  if (args.length != 1) {
+    stderr.writeln(
+        'Usage: dart cpu_samples_to_instructions_order.dart <samples.json>');
+    exit(1);
+  }
+  var json = jsonDecode(File(args[0]).readAsStringSync());
+  if (json is Map && json.containsKey('result')) json = json['result'];
+
+  final names = <String?>[
+    for (final f in json['functions'] as List)
+      nameOf((f as Map<String, dynamic>)['function'] as Map<String, dynamic>),
+  ];
+  final selfSamples = List<int>.filled(names.length, 0);
+  final present = List<bool>.filled(names.length, false);
+  // Samples in which a caller (key) called a callee (index).
+  final callers = List<Map<int, int>>.generate(names.length, (_) => {});
+  for (final sample in json['samples'] as List) {
+    // The stack starts with the innermost frame.
+    final stack = (sample['stack'] as List).cast<int>();
+    if (stack.isEmpty) continue;
+    selfSamples[stack.first]++;
+    for (int i = 0; i < stack.length; i++) {
+      present[stack[i]] = true;
+      if (i + 1 < stack.length && stack[i] != stack[i + 1]) {
+        callers[stack[i]].update(stack[i + 1], (n) => n + 1, ifAbsent: () => 1);
+      }
+    }
+  }
+
+  final functions = <int>[
+    for (int i = 0; i < names.length; i++)
+      if (present[i] && names[i] != null) i,
+  ]..sort((a, b) => selfSamples[b].compareTo(selfSamples[a]));
+  final clusterOf = <int, Cluster>{
+    for (final f in functions) f: Cluster(f, selfSamples[f]),
+  };
+
+  for (final f in functions) {
+    int? hottestCaller;
+    for (final entry in callers[f].entries) {
+      if (!clusterOf.containsKey(entry.key)) continue;
+      if (hottestCaller == null || entry.value > callers[f][hottestCaller]!) {
+        hottestCaller = entry.key;
+      }
+    }
+    if (hottestCaller == null) continue;
+    final callerCluster = clusterOf[hottestCaller]!;
+    final cluster = clusterOf[f]!;
+    if (identical(callerCluster, cluster) ||
+        callerCluster.functions.length + cluster.functions.length >
+            MAX_CLUSTER_SIZE) {
+      continue;
+    }
+    callerCluster.functions.addAll(cluster.functions);
+    callerCluster.samples += cluster.samples;
+    for (final g in cluster.functions) {
+      clusterOf[g] = callerCluster;
+    }
+  }
+
+  final clusters = clusterOf.values.toSet().toList()
+    ..sort((a, b) => b.density.compareTo(a.density));
+  final printed = <String>{};
+  for (final cluster in clusters) {
+    for (final f in cluster.functions) {
+      if (printed.add(names[f]!)) print(names[f]);
+    }
+  }
+}
@@ -0,0 +1,167 @@
+#!/usr/bin/env python3
+# Copyright (c) 2026, the Dart project authors.  Please see the AUTHORS file
+# for details. All rights reserved. Use of this source code is governed by a
+# BSD-style license that can be found in the LICENSE file.
+"""
+Merge coverage bitmaps written by the VM's --write_coverage_bitmap_to flag.
+
+Every input file holds, per script, one record for each instrumented
+function: its source range, a sorted list of encoded coverage positions and
+one hit bit per position (see runtime/vm/coverage_bitmap.cc). Functions which
+were never compiled have no positions. Merging takes the union of all
+functions and positions and ORs their hit bits, so a location counts as
+covered if any of the runs executed it.
+
+Usage:
+  merge_coverage_bitmaps.py -o merged.dcov run1.dcov run2.dcov ...
+  merge_coverage_bitmaps.py --summary run1.dcov run2.dcov ...
+"""
+
+import argparse
+import sys
+
+MAGIC = b'DCOV'
+VERSION = 1
+
+
+def read_leb128(data, offset):
+    result = 0
+    shift = 0
+    while True:
+        byte = data[offset]
+        offset += 1
+        result |= (byte & 0x7f) << shift
+        shift += 7
+        if byte & 0x80 == 0:
+            return result, offset
+
+
+def write_leb128(out, value):
+    while True:
+        byte = value & 0x7f
+        value >>= 7
+        if value != 0:
+            out.append(byte | 0x80)
+        else:
+            out.append(byte)
+            return
+
+
+def read_bitmap(path, scripts):
+    """Merges the bitmap at |path| into |scripts|.
+
+    |scripts| maps urls to {(start, end): {position: hit}}.
+    """
+    with open(path, 'rb') as f:
+        data = f.read()
+    if data[:len(MAGIC)] != MAGIC:
+        raise ValueError('%s: not a coverage bitmap' % path)
+    offset = len(MAGIC)
+    version, offset = read_leb128(data, offset)
+    if version != VERSION:
+        raise ValueError('%s: unsupported version %d' % (path, version))
+    script_count, offset = read_leb128(data, offset)
+    for _ in range(script_count):
+        url_length, offset = read_leb128(data, offset)
+        url = data[offset:offset + url_length].decode('utf-8')
+        offset += url_length
+        functions = scripts.setdefault(url, {})
+        function_count, offset = read_leb128(data, offset)
+        for _ in range(function_count):
+            start, offset = read_leb128(data, offset)
+            length, offset = read_leb128(data, offset)
+            count, offset = read_leb128(data, offset)
+            positions = []
+            position = 0
+            for _ in range(count):
+                delta, offset = read_leb128(data, offset)
+                position += delta
+                positions.append(position)
+            bitmap = data[offset:offset + (count + 7) // 8]
+            offset += len(bitmap)
+            hits = functions.setdefault((start, start + length), {})
+            for i, position in enumerate(positions):
+                hit = (bitmap[i // 8] >> (i % 8)) & 1 == 1
+                hits[position] = hits.get(position, False) or hit
+    if offset != len(data):
+        raise ValueError('%s: trailing data' % path)
+
+
+def write_bitmap(path, scripts):
+    out = bytearray(MAGIC)
+    write_leb128(out, VERSION)
+    write_leb128(out, len(scripts))
+    for url in sorted(scripts):
+        functions = scripts[url]
+        encoded_url = url.encode('utf-8')
+        write_leb128(out, len(encoded_url))
+        out += encoded_url
+        write_leb128(out, len(functions))
+        for start, end in sorted(functions):
+            hits = functions[(start, end)]
+            positions = sorted(hits)
+            write_leb128(out, start)
+            write_leb128(out, end - start)
+            write_leb128(out, len(positions))
+            previous = 0
+            for position in positions:
+                write_leb128(out, position - previous)
+                previous = position
+            bitmap = bytearray((len(positions) + 7) // 8)
+            for i, position in enumerate(positions):
+                if hits[position]:
+                    bitmap[i // 8] |= 1 << (i % 8)
+            out += bitmap
+    with open(path, 'wb') as f:
+        f.write(out)
+
+
+def print_summary(scripts):
+    """Prints covered/instrumented functions and locations per script.
+
+    A function counts as covered if any of its locations was executed. A
+    function which was never compiled in any run has no locations and counts
+    as one uncovered location, so that it lowers the totals.
+    """
+    totals = [0, 0, 0, 0]
+    print('%-13s %-13s %s' % ('functions', 'locations', 'script'))
+    for url in sorted(scripts):
+        functions = scripts[url]
+        covered_functions = 0
+        covered_locations = 0
+        locations = 0
+        for hits in functions.values():
+            hit_count = sum(1 for hit in hits.values() if hit)
+            covered_functions += 1 if hit_count > 0 else 0
+            covered_locations += hit_count
+            locations += max(len(hits), 1)
+        counts = [covered_functions, len(functions), covered_locations,
+                  locations]
+        totals = [total + count for total, count in zip(totals, counts)]
+        print('%6d/%-6d %6d/%-6d %s' % tuple(counts + [url]))
+    print('%6d/%-6d %6d/%-6d total' % tuple(totals))
+
+
+def main():
+    parser = argparse.ArgumentParser(
+        description='Merge VM coverage bitmaps (.dcov files).')
+    parser.add_argument('-o', '--output', help='Write the merged bitmap here.')
+    parser.add_argument('--summary',
+                        action='store_true',
+                        help='Print covered/instrumented functions and locations per '
+                        'script.')
+    parser.add_argument('inputs', nargs='+', help='Bitmaps to merge.')
+    args = parser.parse_args()
+
+    scripts = {}
+    for path in args.inputs:
+        read_bitmap(path, scripts)
+    if args.output:
+        write_bitmap(args.output, scripts)
+    if args.summary or not args.output:
+        print_summary(scripts)
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -59,6 +59,11 @@ DEFINE_FLAG(bool,
             false,
             "Print information about how many array are candidates for Smi and "
             "ROData optimizations.");
+DEFINE_FLAG(charp,
+            instructions_order_file,
+            nullptr,
+            "Lay out the instructions of functions named in the given file, "
+            "one per line, first and in that order in AOT snapshots.");
 #endif  // defined(DART_PRECOMPILER)
 
 // Forward declarations.
@@ -542,6 +547,11 @@ class Serializer : public ThreadStackResource {
 
   bool InCurrentLoadingUnitOrRoot(ObjectPtr obj);
   void RecordDeferredCode(CodePtr ptr);
+
+  // The position of the function [code] was compiled for among the names
+  // in --instructions_order_file, or kIntptrMax if it is not listed. Listed
+  // code is laid out first, in the order of the file.
+  intptr_t InstructionsOrderOf(CodePtr code);
   GrowableArray<LoadingUnitSerializationData*>* loading_units() const {
     return loading_units_;
   }
@@ -637,6 +647,10 @@ class Serializer : public ThreadStackResource {
 #if defined(DART_PRECOMPILER)
   IntMap<intptr_t> deduped_instructions_sources_;
   IntMap<intptr_t> code_index_;
+  // Maps function names to their position in --instructions_order_file.
+  // Filled on first use.
+  CStringIntMap instructions_order_;
+  bool instructions_order_loaded_ = false;
 #endif
 
   intptr_t current_loading_unit_id_ = 0;
@@ -2725,6 +2739,7 @@ class CodeSerializationCluster : public SerializationCluster {
     CodePtr code;
     intptr_t not_discarded;  // 1 if this code was not discarded and
                              // 0 otherwise.
+    intptr_t order;          // See Serializer::InstructionsOrderOf.
     intptr_t instructions_id;
   };
 
@@ -2739,10 +2754,14 @@ class CodeSerializationCluster : public SerializationCluster {
   // there is no way to identify which specific Code object (out of those
   // which point to the specific instructions range) actually corresponds
   // to a particular frame.
+  //
+  // Within each group, code listed in --instructions_order_file comes first.
   static int CompareCodeOrderInfo(CodeOrderInfo const* a,
                                   CodeOrderInfo const* b) {
     if (a->not_discarded < b->not_discarded) return -1;
     if (a->not_discarded > b->not_discarded) return 1;
+    if (a->order < b->order) return -1;
+    if (a->order > b->order) return 1;
     if (a->instructions_id < b->instructions_id) return -1;
     if (a->instructions_id > b->instructions_id) return 1;
     return 0;
@@ -2769,6 +2788,11 @@ class CodeSerializationCluster : public SerializationCluster {
     info.code = code;
     info.instructions_id = instructions_id;
     info.not_discarded = Code::IsDiscarded(code) ? 0 : 1;
+#if defined(DART_PRECOMPILER)
+    info.order = s->InstructionsOrderOf(code);
+#else
+    info.order = 0;
+#endif
     order_list->Add(info);
   }
 
@@ -7447,7 +7471,8 @@ Serializer::Serializer(Thread* thread,
 #endif
 #if defined(DART_PRECOMPILER)
       ,
-      deduped_instructions_sources_(zone_)
+      deduped_instructions_sources_(zone_),
+      instructions_order_(zone_)
 #endif
 {
   num_cids_ = thread->isolate_group()->class_table()->NumCids();
@@ -8106,6 +8131,63 @@ intptr_t Serializer::GetCodeIndex(CodePtr code) {
     return 1 + (ref - code_cluster_->first_ref());
   }
 }
+
+intptr_t Serializer::InstructionsOrderOf(CodePtr code) {
+  if ((FLAG_instructions_order_file == nullptr) ||
+      (kind() != Snapshot::kFullAOT)) {
+    return 0;
+  }
+  if (!instructions_order_loaded_) {
+    instructions_order_loaded_ = true;
+    auto file_open = Dart::file_open_callback();
+    auto file_read = Dart::file_read_callback();
+    auto file_close = Dart::file_close_callback();
+    void* file = (file_open != nullptr)
+                     ? file_open(FLAG_instructions_order_file, /*write=*/false)
+                     : nullptr;
+    if ((file == nullptr) || (file_read == nullptr) ||
+        (file_close == nullptr)) {
+      OS::PrintErr("warning: failed to read instructions order from %s\n",
+                   FLAG_instructions_order_file);
+      return kIntptrMax;
+    }
+    uint8_t* data = nullptr;
+    intptr_t length = -1;
+    file_read(&data, &length, file);
+    file_close(file);
+    intptr_t position = 0;
+    for (intptr_t start = 0; start < length;) {
+      intptr_t end = start;
+      while ((end < length) && (data[end] != '\n')) {
+        ++end;
+      }
+      intptr_t line_end = end;
+      if ((line_end > start) && (data[line_end - 1] == '\r')) {
+        --line_end;
+      }
+      // Empty lines and comments are skipped.
+      if ((line_end > start) && (data[start] != '#')) {
+        const char* name = zone_->MakeCopyOfStringN(
+            reinterpret_cast<const char*>(data + start), line_end - start);
+        if (instructions_order_.LookupValue(name) ==
+            CStringIntMapKeyValueTrait::kNoValue) {
+          instructions_order_.Insert({name, position++});
+        }
+      }
+      start = end + 1;
+    }
+    free(data);
+  }
+  const ObjectPtr owner = code->untag()->owner_;
+  if (owner->GetClassId() != kFunctionCid) {
+    return kIntptrMax;
+  }
+  ZoneTextBuffer name(zone_);
+  Function::Handle(zone_, Function::RawCast(owner))
+      .PrintName(NameFormattingParams(Object::kUserVisibleName), &name);
+  const intptr_t order = instructions_order_.LookupValue(name.buffer());
+  return (order == CStringIntMapKeyValueTrait::kNoValue) ? kIntptrMax : order;
+}
 #endif  // defined(DART_PRECOMPILER)
 
 void Serializer::PrepareInstructions(
@@ -18,8 +18,10 @@
 #include "vm/app_snapshot.h"
 #include "vm/dart_api_impl.h"
 #include "vm/datastream.h"
+#include "vm/lockers.h"
 #include "vm/message_snapshot.h"
 #include "vm/stack_frame.h"
+#include "vm/thread_pool.h"
 #include "vm/timer.h"
 
 using dart::bin::File;
@@ -357,6 +359,56 @@ BENCHMARK(FrameLookup) {
   benchmark->set_score(elapsed_time);
 }
 
+static const char* kInvokeClosureScriptChars =
+    R"(
+    @pragma('vm:entry-point', 'call')
+    Function makeClosure() => (int i) => i + 1;
+    )";
+static const intptr_t kInvokeClosureLoopCount = 100000;
+
+// Measures calling a closure from C with Dart_InvokeClosure.
+BENCHMARK(InvokeClosure) {
+  Dart_Handle lib =
+      TestCase::LoadTestScript(kInvokeClosureScriptChars, nullptr);
+  Dart_Handle closure = Dart_Invoke(lib, NewString("makeClosure"), 0, nullptr);
+  EXPECT_VALID(closure);
+  Timer timer;
+  timer.Start();
+  for (intptr_t i = 0; i < kInvokeClosureLoopCount; i++) {
+    Dart_EnterScope();
+    Dart_Handle args[1] = {Dart_NewInteger(i)};
+    Dart_Handle result = Dart_InvokeClosure(closure, 1, args);
+    EXPECT_VALID(result);
+    Dart_ExitScope();
+  }
+  timer.Stop();
+  int64_t elapsed_time = timer.TotalElapsedTime();
+  benchmark->set_score(elapsed_time);
+}
+
+// Measures calling the same closure through a Dart_ClosureInvocation.
+BENCHMARK(InvokeClosureInvocation) {
+  Dart_Handle lib =
+      TestCase::LoadTestScript(kInvokeClosureScriptChars, nullptr);
+  Dart_Handle closure = Dart_Invoke(lib, NewString("makeClosure"), 0, nullptr);
+  EXPECT_VALID(closure);
+  Dart_ClosureInvocation invocation = nullptr;
+  EXPECT_VALID(Dart_NewClosureInvocation(closure, 1, &invocation));
+  Timer timer;
+  timer.Start();
+  for (intptr_t i = 0; i < kInvokeClosureLoopCount; i++) {
+    Dart_EnterScope();
+    Dart_Handle args[1] = {Dart_NewInteger(i)};
+    Dart_Handle result = Dart_InvokeClosureInvocation(invocation, args);
+    EXPECT_VALID(result);
+    Dart_ExitScope();
+  }
+  timer.Stop();
+  Dart_DeleteClosureInvocation(invocation);
+  int64_t elapsed_time = timer.TotalElapsedTime();
+  benchmark->set_score(elapsed_time);
+}
+
 BENCHMARK_SIZE(CoreSnapshotSize) {
   const char* kScriptChars =
       "import 'dart:async';\n"
@@ -472,6 +524,61 @@ BENCHMARK(EnterExitIsolate) {
   benchmark->set_score(elapsed_time);
 }
 
+class EnterExitIsolateGroupTask : public ThreadPool::Task {
+ public:
+  EnterExitIsolateGroupTask(IsolateGroup* isolate_group,
+                            intptr_t loop_count,
+                            Monitor* monitor,
+                            intptr_t* pending)
+      : isolate_group_(isolate_group),
+        loop_count_(loop_count),
+        monitor_(monitor),
+        pending_(pending) {}
+
+  virtual void Run() {
+    const bool kBypassSafepoint = false;
+    for (intptr_t i = 0; i < loop_count_; i++) {
+      Thread::EnterIsolateGroupAsHelper(isolate_group_, Thread::kUnknownTask,
+                                        kBypassSafepoint);
+      Thread::ExitIsolateGroupAsHelper(kBypassSafepoint);
+    }
+    MonitorLocker ml(monitor_);
+    (*pending_)--;
+    ml.Notify();
+  }
+
+ private:
+  IsolateGroup* isolate_group_;
+  intptr_t loop_count_;
+  Monitor* monitor_;
+  intptr_t* pending_;
+};
+
+// Measures how long it takes helper threads to enter and leave an isolate
+// group while several of them contend on its thread registry.
+BENCHMARK(EnterExitIsolateGroupContended) {
+  const intptr_t kTaskCount = 8;
+  const intptr_t kLoopCount = 100000;
+  IsolateGroup* isolate_group = thread->isolate_group();
+  Monitor monitor;
+  intptr_t pending = kTaskCount;
+  Timer timer;
+  timer.Start();
+  for (intptr_t i = 0; i < kTaskCount; i++) {
+    Dart::thread_pool()->Run<EnterExitIsolateGroupTask>(
+        isolate_group, kLoopCount, &monitor, &pending);
+  }
+  {
+    MonitorLocker ml(&monitor);
+    while (pending > 0) {
+      ml.Wait();
+    }
+  }
+  timer.Stop();
+  int64_t elapsed_time = timer.TotalElapsedTime();
+  benchmark->set_score(elapsed_time);
+}
+
 BENCHMARK(SerializeNull) {
   TransitionNativeToVM transition(thread);
   StackZone zone(thread);
@@ -537,6 +644,28 @@ BENCHMARK(SimpleMessage) {
   benchmark->set_score(elapsed_time);
 }
 
+BENCHMARK(SerializeApiInt) {
+  TransitionNativeToVM transition(thread);
+  StackZone zone(thread);
+  Dart_CObject cobj;
+  cobj.type = Dart_CObject_kInt64;
+  const intptr_t kLoopCount = 1000000;
+  Timer timer;
+  timer.Start();
+  for (intptr_t i = 0; i < kLoopCount; i++) {
+    StackZone zone(thread);
+    cobj.value.as_int64 = i;
+    std::unique_ptr<Message> message = WriteApiMessage(
+        zone.GetZone(), &cobj, ILLEGAL_PORT, Message::kNormalPriority);
+
+    // Read object back from the snapshot.
+    ReadMessage(thread, message.get());
+  }
+  timer.Stop();
+  int64_t elapsed_time = timer.TotalElapsedTime();
+  benchmark->set_score(elapsed_time);
+}
+
 BENCHMARK(LargeMap) {
   const char* kScript =
       "@pragma('vm:entry-point', 'call')\n"
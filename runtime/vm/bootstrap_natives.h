@@ -143,10 +143,7 @@ namespace dart {
   V(Error_trySetStackTrace, 2)                                                 \
   V(StackTrace_current, 0)                                                     \
   V(TypeError_throwNew, 4)                                                     \
-  V(Stopwatch_now, 0)                                                          \
-  V(Stopwatch_frequency, 0)                                                    \
   V(Timeline_getNextTaskId, 0)                                                 \
-  V(Timeline_getTraceClock, 0)                                                 \
   V(Timeline_isDartStreamEnabled, 0)                                           \
   V(Timeline_reportTaskEvent, 5)                                               \
   V(TypedDataBase_length, 1)                                                   \
@@ -277,6 +274,7 @@ namespace dart {
   V(Internal_deoptimizeFunctionsOnStack, 0)                                    \
   V(Internal_allocateObjectInstructionsStart, 0)                               \
   V(Internal_allocateObjectInstructionsEnd, 0)                                 \
+  V(Internal_safepointPollFaultCount, 0)                                       \
   V(InvocationMirror_unpackTypeArguments, 2)                                   \
   V(NoSuchMethodError_existingMethodSignature, 3)                              \
   V(Uri_isWindowsPlatform, 0)                                                  \
@@ -376,7 +374,10 @@ namespace dart {
   V(Mutex_Lock, void, (Dart_Handle))                                           \
   V(Mutex_Unlock, void, (Dart_Handle))                                         \
   V(Pointer_asTypedListFinalizerAllocateData, void*, ())                       \
-  V(Pointer_asTypedListFinalizerCallbackPointer, void*, ())
+  V(Pointer_asTypedListFinalizerCallbackPointer, void*, ())                    \
+  V(Stopwatch_frequency, int64_t, ())                                          \
+  V(Stopwatch_now, int64_t, ())                                                \
+  V(Timeline_getTraceClock, int64_t, ())
 
 class BootstrapNatives : public AllStatic {
  public:
@@ -34,6 +34,7 @@
 #include "vm/compiler/frontend/flow_graph_builder.h"
 #include "vm/compiler/frontend/kernel_to_il.h"
 #include "vm/compiler/jit/compiler.h"
+#include "vm/coverage_bitmap.h"
 #include "vm/dart_entry.h"
 #include "vm/exceptions.h"
 #include "vm/ffi/native_assets.h"
@@ -80,6 +81,21 @@ DEFINE_FLAG(charp,
             write_retained_reasons_to,
             nullptr,
             "Print reasons for retaining objects to the given file");
+DEFINE_FLAG(bool,
+            precompiler_result_summaries,
+            false,
+            "Summarize the class, nullability and range of the results of "
+            "compiled functions and use them when compiling their callers. "
+            "Callers compiled before their callees are compiled again.");
+DEFINE_FLAG(bool,
+            trace_result_summaries,
+            false,
+            "Print result summaries and how many checks they removed.");
+DEFINE_FLAG(bool,
+            aot_coverage,
+            false,
+            "Instrument precompiled code to record coverage, which is written "
+            "out by --write_coverage_bitmap_to.");
 
 DECLARE_FLAG(bool, print_flow_graph);
 DECLARE_FLAG(bool, print_flow_graph_optimized);
@@ -97,6 +113,7 @@ DECLARE_FLAG(int, inlining_caller_size_threshold);
 DECLARE_FLAG(int, inlining_constant_arguments_max_size_threshold);
 DECLARE_FLAG(int, inlining_constant_arguments_min_size_threshold);
 DECLARE_FLAG(bool, print_instruction_stats);
+DECLARE_FLAG(bool, write_barrier_elimination_across_calls);
 
 Precompiler* Precompiler::singleton_ = nullptr;
 
@@ -403,6 +420,9 @@ Precompiler::Precompiler(Thread* thread)
           thread->isolate_group()->object_store()->libraries())),
       pending_functions_(
           GrowableObjectArray::Handle(GrowableObjectArray::New())),
+      coverage_arrays_(GrowableObjectArray::Handle(GrowableObjectArray::New())),
+      functions_to_recompile_(
+          GrowableObjectArray::Handle(GrowableObjectArray::New())),
       sent_selectors_(),
       functions_called_dynamically_(
           HashTables::New<FunctionSet>(/*initial_capacity=*/1024)),
@@ -508,6 +528,13 @@ void Precompiler::DoCompileAll() {
 
       tracer_ = PrecompilerTracer::StartTracingIfRequested(this);
 
+      // Only functions compiled from here on are accounted by the cost model,
+      // the constructors above were compiled for their instruction counts.
+      if (InliningCostModel::IsEnabled()) {
+        inlining_cost_model_ = new (Z) InliningCostModel(Z);
+        inlining_cost_model_->Init();
+      }
+
       // All stubs have already been generated, all of them share the same pool.
       // We use that pool to initialize our global object pool, to guarantee
       // stubs as well as code compiled from here on will have the same pool.
@@ -559,6 +586,10 @@ void Precompiler::DoCompileAll() {
       // fixed point.
       Iterate();
 
+      if (FLAG_precompiler_result_summaries) {
+        RecompileForResultSummaries();
+      }
+
       // Replace the default type testing stubs installed on [Type]s with new
       // [Type]-specialized stubs.
       AttachOptimizedTypeTestingStub();
@@ -583,6 +614,49 @@ void Precompiler::DoCompileAll() {
         tracer_ = nullptr;
       }
 
+      if (inlining_cost_model_ != nullptr) {
+        inlining_cost_model_->WriteLog();
+        inlining_cost_model_ = nullptr;
+      }
+
+      if (FLAG_trace_result_summaries) {
+        intptr_t count = 0;
+        intptr_t non_nullable_count = 0;
+        intptr_t cid_count = 0;
+        intptr_t range_count = 0;
+        auto it = result_summaries_.GetIterator();
+        for (auto summary = it.Next(); summary != nullptr;
+             summary = it.Next()) {
+          ++count;
+          if (!(*summary)->is_nullable) ++non_nullable_count;
+          if ((*summary)->cid != kDynamicCid) ++cid_count;
+          if ((*summary)->has_range) ++range_count;
+        }
+        intptr_t null_checks = 0;
+        intptr_t class_checks = 0;
+        intptr_t bound_checks = 0;
+        auto checks_it = removed_checks_.GetIterator();
+        for (auto checks = checks_it.Next(); checks != nullptr;
+             checks = checks_it.Next()) {
+          null_checks += (*checks)->null_checks;
+          class_checks += (*checks)->class_checks;
+          bound_checks += (*checks)->bound_checks;
+        }
+        THR_Print("Result summaries: %" Pd " functions (%" Pd
+                  " non-nullable, %" Pd " with known class, %" Pd
+                  " with range), %" Pd " callers recompiled\n",
+                  count, non_nullable_count, cid_count, range_count,
+                  functions_to_recompile_.Length());
+        THR_Print("Checks removed by result summaries: %" Pd " null, %" Pd
+                  " class, %" Pd " bounds\n",
+                  null_checks, class_checks, bound_checks);
+      }
+
+      if (FLAG_aot_coverage) {
+        IG->object_store()->set_aot_coverage(Array::Handle(
+            Z, CoverageBitmap::CreateAotTable(T, coverage_arrays_)));
+      }
+
       {
         PRECOMPILER_TIMER_SCOPE(this, TraceForRetainedFunctions);
         TraceForRetainedFunctions();
@@ -3600,6 +3674,10 @@ bool PrecompileParsedFunctionHelper::Compile() {
                                CompilerState::ShouldTrace(function));
   compiler_state.set_function(function);
 
+  if (FLAG_precompiler_result_summaries) {
+    precompiler_->StartResultSummaryUses(function);
+  }
+
   {
     ZoneGrowableArray<const ICData*>* ic_data_array =
         new (zone) ZoneGrowableArray<const ICData*>();
@@ -3628,6 +3706,9 @@ bool PrecompileParsedFunctionHelper::Compile() {
   }
 
   ASSERT(precompiler_ != nullptr);
+  if (FLAG_precompiler_result_summaries) {
+    precompiler_->RecordResultSummary(flow_graph);
+  }
 
   // When generating code in bare instruction mode all code objects
   // share the same global object pool. To reduce interleaving of
@@ -3639,7 +3720,202 @@ bool PrecompileParsedFunctionHelper::Compile() {
   // failure to commit object pool into the global object pool.
   GenerateNecessaryAllocationStubs(flow_graph);
 
-  return GenerateCode(flow_graph);
+  const bool is_compiled = GenerateCode(flow_graph);
+  if (FLAG_precompiler_result_summaries) {
+    precompiler_->FinishResultSummaryUses(flow_graph, is_compiled);
+  }
+  // Callers may only rely on the code that ends up in the snapshot: the IL
+  // of a constructor compiled for its instruction count, or of an attempt
+  // whose code was not committed, may differ from it.
+  if (is_compiled && FLAG_write_barrier_elimination_across_calls &&
+      precompiler_->phase() == Precompiler::Phase::kFixpointCodeGeneration) {
+    precompiler_->RecordGCFreeFunction(flow_graph);
+  }
+  return is_compiled;
+}
+
+// Whether the values returned in the IL of [function] are what its callers
+// receive. Suspendable functions return a Future, Stream or Iterable built
+// by the suspend stubs, and dispatchers, trampolines and constructors are
+// not summarized either.
+static bool HasPlainReturn(const Function& function) {
+  if (function.IsSuspendableFunction()) {
+    return false;
+  }
+  switch (function.kind()) {
+    case UntaggedFunction::kRegularFunction:
+    case UntaggedFunction::kGetterFunction:
+    case UntaggedFunction::kImplicitGetter:
+    case UntaggedFunction::kImplicitStaticGetter:
+      return true;
+    default:
+      return false;
+  }
+}
+
+void Precompiler::RecordResultSummary(FlowGraph* flow_graph) {
+  const Function& function = flow_graph->function();
+  if (!HasPlainReturn(function)) return;
+  intptr_t cid = kIllegalCid;
+  bool is_nullable = false;
+  bool has_range = true;
+  int64_t min = kMaxInt64;
+  int64_t max = kMinInt64;
+  intptr_t return_count = 0;
+  for (BlockIterator block_it = flow_graph->reverse_postorder_iterator();
+       !block_it.Done(); block_it.Advance()) {
+    for (ForwardInstructionIterator it(block_it.Current()); !it.Done();
+         it.Advance()) {
+      auto* ret = it.Current()->AsDartReturn();
+      if (ret == nullptr) continue;
+      ++return_count;
+      CompileType* type = ret->value()->Type();
+      const intptr_t value_cid = type->ToNullableCid();
+      if (cid == kIllegalCid) {
+        cid = value_cid;
+      } else if (cid != value_cid) {
+        cid = kDynamicCid;
+      }
+      is_nullable = is_nullable || type->is_nullable();
+      Range* range = ret->value()->definition()->range();
+      if (!type->IsInt() || Range::IsUnknown(range)) {
+        has_range = false;
+      } else {
+        min = Utils::Minimum(min, Range::ConstantMin(range).ConstantValue());
+        max = Utils::Maximum(max, Range::ConstantMax(range).ConstantValue());
+      }
+    }
+  }
+  // Functions that never return have nothing to summarize.
+  if (return_count == 0) return;
+  // A summary that adds nothing to the declared result type is not recorded.
+  if ((cid == kDynamicCid) && is_nullable && !has_range) return;
+
+  auto* summary =
+      new (Z) ResultSummary(&Function::ZoneHandle(Z, function.ptr()), cid,
+                            is_nullable, has_range, min, max);
+  result_summaries_.Update(summary);
+  if (FLAG_trace_result_summaries) {
+    THR_Print("Result summary of %s: cid %" Pd "%s", function.ToCString(), cid,
+              is_nullable ? " (nullable)" : "");
+    if (has_range) {
+      THR_Print(" range [%" Pd64 ", %" Pd64 "]", min, max);
+    }
+    THR_Print("\n");
+  }
+}
+
+void Precompiler::StartResultSummaryUses(const Function& function) {
+  pending_removed_checks_ = nullptr;
+  if (FLAG_trace_result_summaries &&
+      (phase_ == Phase::kFixpointCodeGeneration)) {
+    pending_removed_checks_ =
+        new (Z) RemovedChecks(&Function::ZoneHandle(Z, function.ptr()));
+  }
+}
+
+void Precompiler::FinishResultSummaryUses(FlowGraph* flow_graph,
+                                          bool is_compiled) {
+  RemovedChecks* removed_checks = pending_removed_checks_;
+  pending_removed_checks_ = nullptr;
+  // Only the code written to the snapshot counts: constructors compiled for
+  // their instruction counts and attempts that bailed out are compiled again.
+  if (!is_compiled || (phase_ != Phase::kFixpointCodeGeneration)) return;
+  if (removed_checks != nullptr) {
+    removed_checks_.Update(removed_checks);
+  }
+  if (recompiling_for_summaries_) return;
+
+  // The precompiler only discovers the callees of a function by compiling
+  // it, so most static calls are compiled before their target has a summary.
+  const Function& function = flow_graph->function();
+  for (BlockIterator block_it = flow_graph->reverse_postorder_iterator();
+       !block_it.Done(); block_it.Advance()) {
+    for (ForwardInstructionIterator it(block_it.Current()); !it.Done();
+         it.Advance()) {
+      auto* call = it.Current()->AsStaticCall();
+      if ((call != nullptr) && !call->function().HasCode() &&
+          HasPlainReturn(call->function())) {
+        functions_to_recompile_.Add(function);
+        return;
+      }
+    }
+  }
+}
+
+// Compiles the functions which had static calls to callees without a
+// summary once more, now that every reachable function was compiled and
+// summarized. Functions first found by these compilations are compiled
+// with the summaries available by then.
+void Precompiler::RecompileForResultSummaries() {
+  HANDLESCOPE(T);
+  Function& function = Function::Handle(Z);
+  recompiling_for_summaries_ = true;
+  phase_ = Phase::kFixpointCodeGeneration;
+  for (intptr_t i = 0; i < functions_to_recompile_.Length(); i++) {
+    function ^= functions_to_recompile_.At(i);
+    function.ClearCode();
+    ProcessFunction(function);
+  }
+  Iterate();
+  recompiling_for_summaries_ = false;
+}
+
+void Precompiler::CountRemovedCheckOf(Instruction* check, Value* value) {
+  Definition* defn = value->definition()->OriginalDefinition();
+  if (auto* unbox = defn->AsUnboxInteger()) {
+    defn = unbox->value()->definition()->OriginalDefinition();
+  }
+  auto* call = defn->AsStaticCall();
+  if (call == nullptr) return;
+  const ResultSummary* summary = LookupResultSummary(call->function());
+  if (summary == nullptr) return;
+  // Type flow analysis may already have established what the check needs,
+  // in which case the summary did not make a difference.
+  CompileType* inferred_type = call->result_type();
+  if (check->IsCheckNull()) {
+    if (!summary->is_nullable &&
+        ((inferred_type == nullptr) || inferred_type->is_nullable())) {
+      ++pending_removed_checks_->null_checks;
+    }
+  } else if (check->IsCheckClass()) {
+    if ((summary->cid != kDynamicCid) &&
+        ((inferred_type == nullptr) ||
+         (inferred_type->ToNullableCid() == kDynamicCid))) {
+      ++pending_removed_checks_->class_checks;
+    }
+  } else if (check->IsCheckBoundBase()) {
+    if (summary->has_range) {
+      ++pending_removed_checks_->bound_checks;
+    }
+  }
+}
+
+void Precompiler::RecordGCFreeFunction(FlowGraph* flow_graph) {
+  const Function& function = flow_graph->function();
+  bool may_throw = false;
+  for (BlockIterator block_it = flow_graph->reverse_postorder_iterator();
+       !block_it.Done(); block_it.Advance()) {
+    for (ForwardInstructionIterator it(block_it.Current()); !it.Done();
+         it.Advance()) {
+      Instruction* current = it.Current();
+      if (auto* call = current->AsStaticCall()) {
+        if (auto* callee = LookupGCFreeFunction(call->function())) {
+          may_throw = may_throw || callee->may_throw;
+          continue;
+        }
+      }
+      if (current->CanCallDart() || current->CanTriggerGC()) {
+        // Drop what an earlier compilation of the function recorded.
+        gc_free_functions_.Remove(&function);
+        return;
+      }
+      // Throwing calls into the runtime, which may trigger GC.
+      may_throw = may_throw || current->MayThrow();
+    }
+  }
+  gc_free_functions_.Update(new (Z) GCFreeFunction(
+      &Function::ZoneHandle(Z, function.ptr()), may_throw));
 }
 
 void Precompiler::CompileFunction(Precompiler* precompiler,
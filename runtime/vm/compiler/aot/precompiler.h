@@ -29,6 +29,7 @@ class GrowableObjectArray;
 class String;
 class Precompiler;
 class FlowGraph;
+class InliningCostModel;
 class PrecompilerTracer;
 class RetainedReasonsWriter;
 
@@ -239,6 +240,98 @@ class InstanceKeyValueTrait {
 
 typedef DirectChainedHashMap<InstanceKeyValueTrait> InstanceSet;
 
+// What the optimized code of a function established about its result: the
+// class of every returned value (or kDynamicCid), whether null may be
+// returned and, for integers, the range of the returned values.
+struct ResultSummary : public ZoneAllocated {
+  ResultSummary(const Function* function,
+                intptr_t cid,
+                bool is_nullable,
+                bool has_range,
+                int64_t min,
+                int64_t max)
+      : function(function),
+        cid(cid),
+        is_nullable(is_nullable),
+        has_range(has_range),
+        min(min),
+        max(max) {}
+
+  const Function* function;
+  intptr_t cid;
+  bool is_nullable;
+  bool has_range;
+  int64_t min;
+  int64_t max;
+};
+
+// How many checks in the code of [function] were removed because the result
+// summaries of its callees made them redundant (see
+// --trace-result-summaries).
+struct RemovedChecks : public ZoneAllocated {
+  explicit RemovedChecks(const Function* function) : function(function) {}
+
+  const Function* function;
+  intptr_t null_checks = 0;
+  intptr_t class_checks = 0;
+  intptr_t bound_checks = 0;
+};
+
+// Maps functions to the zone allocated [T] recorded for them.
+template <typename T>
+class FunctionEntryKeyValueTrait {
+ public:
+  // Typedefs needed for the DirectChainedHashMap template.
+  typedef const Function* Key;
+  typedef T* Value;
+  typedef T* Pair;
+
+  static Key KeyOf(Pair kv) { return kv->function; }
+
+  static Value ValueOf(Pair kv) { return kv; }
+
+  static inline uword Hash(Key key) { return key->Hash(); }
+
+  static inline bool IsKeyEqual(Pair pair, Key key) {
+    return pair->function->ptr() == key->ptr();
+  }
+};
+
+typedef DirectChainedHashMap<FunctionEntryKeyValueTrait<ResultSummary>>
+    ResultSummaryMap;
+typedef DirectChainedHashMap<FunctionEntryKeyValueTrait<RemovedChecks>>
+    RemovedChecksMap;
+
+// A function whose optimized code can neither call Dart code nor trigger GC,
+// except by throwing, and whether it may throw.
+struct GCFreeFunction : public ZoneAllocated {
+  GCFreeFunction(const Function* function, bool may_throw)
+      : function(function), may_throw(may_throw) {}
+
+  const Function* function;
+  bool may_throw;
+};
+
+class GCFreeFunctionKeyValueTrait {
+ public:
+  // Typedefs needed for the DirectChainedHashMap template.
+  typedef const Function* Key;
+  typedef GCFreeFunction* Value;
+  typedef GCFreeFunction* Pair;
+
+  static Key KeyOf(Pair kv) { return kv->function; }
+
+  static Value ValueOf(Pair kv) { return kv; }
+
+  static inline uword Hash(Key key) { return key->Hash(); }
+
+  static inline bool IsKeyEqual(Pair pair, Key key) {
+    return pair->function->ptr() == key->ptr();
+  }
+};
+
+typedef DirectChainedHashMap<GCFreeFunctionKeyValueTrait> GCFreeFunctionMap;
+
 class Precompiler : public ValueObject {
  public:
   static ErrorPtr CompileAll();
@@ -276,6 +369,76 @@ class Precompiler : public ValueObject {
 
   bool is_tracing() const { return is_tracing_; }
 
+  InliningCostModel* inlining_cost_model() const {
+    return inlining_cost_model_;
+  }
+
+  // Records the result summary of the function [flow_graph] was compiled
+  // for (see --precompiler-result-summaries).
+  void RecordResultSummary(FlowGraph* flow_graph);
+
+  // Called before and after compiling [function] for the snapshot with
+  // --precompiler-result-summaries. Remembers callers whose static calls
+  // could not use a summary yet, so that RecompileForResultSummaries
+  // compiles them again, and keeps the checks counted by CountRemovedCheck
+  // if the code was committed.
+  void StartResultSummaryUses(const Function& function);
+  void FinishResultSummaryUses(FlowGraph* flow_graph, bool is_compiled);
+
+  // Counts [check] of [value] as removed if it was only redundant because of
+  // the result summary of the call that defines [value].
+  static void CountRemovedCheck(Instruction* check, Value* value) {
+#if defined(DART_PRECOMPILER) && !defined(TARGET_ARCH_IA32)
+    if ((singleton_ != nullptr) &&
+        (singleton_->pending_removed_checks_ != nullptr)) {
+      singleton_->CountRemovedCheckOf(check, value);
+    }
+#endif
+  }
+
+  // The result summary of an already compiled [function], if any. Calls to
+  // it may assume its result satisfies the summary, which lets functions
+  // compiled later drop null, class and bounds checks on the result and
+  // specialize calls on it.
+  static const ResultSummary* LookupResultSummary(const Function& function) {
+#if defined(DART_PRECOMPILER) && !defined(TARGET_ARCH_IA32)
+    return singleton_ != nullptr ? singleton_->result_summaries_.LookupValue(
+                                       &function)
+                                 : nullptr;
+#else
+    return nullptr;
+#endif
+  }
+
+  // Records whether the code generated for [flow_graph] can neither call
+  // Dart code nor trigger GC (see --write-barrier-elimination-across-calls).
+  // Only called for the code written to the snapshot.
+  void RecordGCFreeFunction(FlowGraph* flow_graph);
+
+  // The entry of an already compiled [function] recorded by
+  // RecordGCFreeFunction, if any. Write barrier elimination keeps the
+  // allocations it tracks across calls to such functions.
+  static const GCFreeFunction* LookupGCFreeFunction(const Function& function) {
+#if defined(DART_PRECOMPILER) && !defined(TARGET_ARCH_IA32)
+    return singleton_ != nullptr
+               ? singleton_->gc_free_functions_.LookupValue(&function)
+               : nullptr;
+#else
+    return nullptr;
+#endif
+  }
+
+  // Records that compiling [function] created [coverage_array] (see
+  // --aot-coverage).
+  static void RecordCoverageArray(const Function& function,
+                                  const Array& coverage_array) {
+#if defined(DART_PRECOMPILER) && !defined(TARGET_ARCH_IA32)
+    if (singleton_ == nullptr || coverage_array.Length() == 0) return;
+    singleton_->coverage_arrays_.Add(function);
+    singleton_->coverage_arrays_.Add(coverage_array);
+#endif
+  }
+
   Thread* thread() const { return thread_; }
   Zone* zone() const { return zone_; }
 
@@ -332,6 +495,8 @@ class Precompiler : public ValueObject {
   bool HasApiUse(const Object& obj);
 
   void ProcessFunction(const Function& function);
+  void RecompileForResultSummaries();
+  void CountRemovedCheckOf(Instruction* check, Value* value);
   void CheckForNewDynamicFunctions();
   void CollectCallbackFields();
 
@@ -388,6 +553,11 @@ class Precompiler : public ValueObject {
   compiler::ObjectPoolBuilder global_object_pool_builder_;
   GrowableObjectArray& libraries_;
   const GrowableObjectArray& pending_functions_;
+  // Pairs of a function and a coverage array created while compiling it.
+  const GrowableObjectArray& coverage_arrays_;
+  // Functions whose static calls could not use the summary of a callee
+  // because it was not compiled yet.
+  const GrowableObjectArray& functions_to_recompile_;
   SymbolSet sent_selectors_;
   FunctionSet functions_called_dynamically_;
   FunctionSet functions_with_entry_point_pragmas_;
@@ -412,6 +582,14 @@ class Precompiler : public ValueObject {
   Phase phase_ = Phase::kPreparation;
   PrecompilerTracer* tracer_ = nullptr;
   RetainedReasonsWriter* retained_reasons_writer_ = nullptr;
+  InliningCostModel* inlining_cost_model_ = nullptr;
+  ResultSummaryMap result_summaries_;
+  RemovedChecksMap removed_checks_;
+  // Checks removed while compiling the current function. They are only
+  // added to removed_checks_ if its code is committed.
+  RemovedChecks* pending_removed_checks_ = nullptr;
+  bool recompiling_for_summaries_ = false;
+  GCFreeFunctionMap gc_free_functions_;
   bool is_tracing_ = false;
 };
 
@@ -21,6 +21,13 @@ DEFINE_FLAG(bool,
             false,
             "Verify instructions offset in code object."
             "NOTE: This breaks the profiler.");
+#if defined(TARGET_ARCH_X64)
+DEFINE_FLAG(bool,
+            compare_to_zero_peephole,
+            true,
+            "Compare integers with zero using test and omit the comparison "
+            "when the preceding arithmetic already set the flags.");
+#endif
 #if defined(TARGET_ARCH_ARM)
 DEFINE_FLAG(bool, use_far_branches, false, "Enable far branches for ARM.");
 #endif
@@ -690,6 +690,21 @@ void Assembler::TestImmediate(Register dst,
   }
 }
 
+void Assembler::CompareToZero(Register reg, OperandSize width, bool equality) {
+  ASSERT(width == kEightBytes || width == kFourBytes);
+  // 32-bit operations zero the upper half of their destination, so ZF also
+  // reflects the whole 64-bit value after them.
+  if (equality && flags_register_ == reg && flags_offset_ == CodeSize() &&
+      (flags_width_ == width || flags_width_ == kFourBytes)) {
+    return;
+  }
+  if (width == kEightBytes) {
+    testq(reg, reg);
+  } else {
+    testl(reg, reg);
+  }
+}
+
 void Assembler::AluL(uint8_t modrm_opcode, Register dst, const Immediate& imm) {
   AssemblerBuffer::EnsureCapacity ensured(&buffer_);
   EmitRegisterREX(dst, REX_NONE);
@@ -1053,6 +1068,24 @@ void Assembler::enter(const Immediate& imm) {
   EmitUint8(0x00);
 }
 
+void Assembler::SafepointPoll(Label* slow_path) {
+  AssemblerBuffer::EnsureCapacity ensured(&buffer_);
+  COMPILE_ASSERT(TMP == R11);
+  // test [r11], r11d
+  EmitUint8(0x45);
+  EmitUint8(0x85);
+  EmitUint8(0x1B);
+  // nop [rax + disp32]
+  EmitUint8(0x0F);
+  EmitUint8(0x1F);
+  EmitUint8(0x80);
+  if (slow_path->IsBound()) {
+    EmitInt32(slow_path->Position() - (buffer_.Size() + 4));
+  } else {
+    EmitLabelLink(slow_path);
+  }
+}
+
 void Assembler::nop(int size) {
   AssemblerBuffer::EnsureCapacity ensured(&buffer_);
   // There are nops up to size 15, but for now just provide up to size 8.
@@ -1826,6 +1859,9 @@ void Assembler::Bind(Label* label) {
     buffer_.Store<int8_t>(position, offset);
   }
   label->BindTo(bound);
+  // Control can reach [bound] from elsewhere, so the flags no longer reflect
+  // the last emitted instruction.
+  flags_register_ = kNoRegister;
 }
 
 void Assembler::Load(Register reg, const Address& address, OperandSize sz) {
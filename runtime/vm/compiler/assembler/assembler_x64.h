@@ -583,6 +583,12 @@ class Assembler : public AssemblerBase {
                      const Immediate& imm,
                      OperandSize width = kEightBytes);
 
+  // Compares [reg] with zero using test instead of cmp, which is shorter and
+  // sets the flags the same way. If [equality] is true only EQUAL and
+  // NOT_EQUAL may be used afterwards, and nothing is emitted when the last
+  // instruction emitted at this position already set ZF from [reg].
+  void CompareToZero(Register reg, OperandSize width, bool equality);
+
   void AndImmediate(Register dst,
                     Register src,
                     const Immediate& imm,
@@ -636,17 +642,33 @@ class Assembler : public AssemblerBase {
 
 #define DECLARE_ALU(op, c)                                                     \
   void op##w(Register dst, Register src) { EmitW(dst, src, c * 8 + 3); }       \
-  void op##l(Register dst, Register src) { EmitL(dst, src, c * 8 + 3); }       \
-  void op##q(Register dst, Register src) { EmitQ(dst, src, c * 8 + 3); }       \
+  void op##l(Register dst, Register src) {                                     \
+    EmitL(dst, src, c * 8 + 3);                                                \
+    RecordFlagsFrom(c, dst, kFourBytes);                                       \
+  }                                                                            \
+  void op##q(Register dst, Register src) {                                     \
+    EmitQ(dst, src, c * 8 + 3);                                                \
+    RecordFlagsFrom(c, dst, kEightBytes);                                      \
+  }                                                                            \
   void op##w(Register dst, const Address& src) { EmitW(dst, src, c * 8 + 3); } \
-  void op##l(Register dst, const Address& src) { EmitL(dst, src, c * 8 + 3); } \
-  void op##q(Register dst, const Address& src) { EmitQ(dst, src, c * 8 + 3); } \
+  void op##l(Register dst, const Address& src) {                               \
+    EmitL(dst, src, c * 8 + 3);                                                \
+    RecordFlagsFrom(c, dst, kFourBytes);                                       \
+  }                                                                            \
+  void op##q(Register dst, const Address& src) {                               \
+    EmitQ(dst, src, c * 8 + 3);                                                \
+    RecordFlagsFrom(c, dst, kEightBytes);                                      \
+  }                                                                            \
   void op##w(const Address& dst, Register src) { EmitW(src, dst, c * 8 + 1); } \
   void op##l(const Address& dst, Register src) { EmitL(src, dst, c * 8 + 1); } \
   void op##q(const Address& dst, Register src) { EmitQ(src, dst, c * 8 + 1); } \
-  void op##l(Register dst, const Immediate& imm) { AluL(c, dst, imm); }        \
+  void op##l(Register dst, const Immediate& imm) {                             \
+    AluL(c, dst, imm);                                                         \
+    RecordFlagsFrom(c, dst, kFourBytes);                                       \
+  }                                                                            \
   void op##q(Register dst, const Immediate& imm) {                             \
     AluQ(c, c * 8 + 3, dst, imm);                                              \
+    RecordFlagsFrom(c, dst, kEightBytes);                                      \
   }                                                                            \
   void op##b(const Address& dst, const Immediate& imm) { AluB(c, dst, imm); }  \
   void op##w(const Address& dst, const Immediate& imm) { AluW(c, dst, imm); }  \
@@ -717,6 +739,10 @@ class Assembler : public AssemblerBase {
   // 'size' indicates size in bytes and must be in the range 1..8.
   void nop(int size = 1);
 
+  // Loads from the page TMP points to and encodes the offset of [slow_path]
+  // in a nop that follows, see SafepointPollPattern.
+  void SafepointPoll(Label* slow_path);
+
   void j(Condition condition, Label* label, JumpDistance distance = kFarJump);
   void jmp(Register reg) { EmitUnaryL(reg, 0xFF, 4); }
   void jmp(const Address& address) { EmitUnaryL(address, 0xFF, 4); }
@@ -1399,6 +1425,20 @@ class Assembler : public AssemblerBase {
  private:
   bool constant_pool_allowed_;
 
+  // Register (and width) whose value the flags reflect if the last emitted
+  // instruction was an arithmetic or logical operation ending at
+  // [flags_offset_]. Used by CompareToZero.
+  Register flags_register_ = kNoRegister;
+  OperandSize flags_width_ = kEightBytes;
+  intptr_t flags_offset_ = -1;
+
+  void RecordFlagsFrom(uint8_t alu_code, Register dst, OperandSize width) {
+    // cmp does not write [dst].
+    flags_register_ = alu_code == 7 ? kNoRegister : dst;
+    flags_width_ = width;
+    flags_offset_ = CodeSize();
+  }
+
   void CallCodeThroughPool(intptr_t target_code_pool_index,
                            CodeEntryKind entry_kind);
 
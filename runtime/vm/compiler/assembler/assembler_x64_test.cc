@@ -9,6 +9,7 @@
 #include "vm/compiler/assembler/assembler_test.h"
 #include "vm/compiler/backend/locations.h"
 #include "vm/cpu.h"
+#include "vm/instructions.h"
 #include "vm/os.h"
 #include "vm/unit_test.h"
 #include "vm/virtual_memory.h"
@@ -778,6 +779,34 @@ ASSEMBLER_TEST_RUN(JumpAddress, test) {
       "ret\n");
 }
 
+static uword safepoint_poll_offset;
+static uword safepoint_poll_slow_path_offset;
+
+ASSEMBLER_TEST_GENERATE(SafepointPoll, assembler) {
+  Label slow_path;
+  __ movq(TMP, CallingConventions::kArg1Reg);
+  safepoint_poll_offset = __ CodeSize();
+  __ SafepointPoll(&slow_path);
+  __ movl(RAX, Immediate(1));
+  __ ret();
+  safepoint_poll_slow_path_offset = __ CodeSize();
+  __ Bind(&slow_path);
+  __ movl(RAX, Immediate(2));
+  __ ret();
+}
+
+ASSEMBLER_TEST_RUN(SafepointPoll, test) {
+  // A readable poll page falls through the poll.
+  int32_t page = 0;
+  typedef int (*TestCode)(void*);
+  EXPECT_EQ(1, reinterpret_cast<TestCode>(test->entry())(&page));
+
+  SafepointPollPattern poll(test->entry() + safepoint_poll_offset);
+  EXPECT(poll.IsValid());
+  EXPECT_EQ(test->entry() + safepoint_poll_slow_path_offset, poll.slow_path());
+  EXPECT(!SafepointPollPattern(test->entry()).IsValid());
+}
+
 ASSEMBLER_TEST_GENERATE(Increment, assembler) {
   __ movq(RAX, Immediate(0));
   __ pushq(RAX);
@@ -1992,6 +2021,47 @@ ASSEMBLER_TEST_RUN(Bitwise64, test) {
       "ret\n");
 }
 
+ASSEMBLER_TEST_GENERATE(CompareToZero, assembler) {
+  Label join;
+  __ movq(RCX, Immediate(1));
+  __ subq(RCX, Immediate(1));
+  // Omitted: subq set ZF from RCX.
+  __ CompareToZero(RCX, kEightBytes, /*equality=*/true);
+  __ setcc(EQUAL, CL);
+  __ movq(RAX, Immediate(-1));
+  __ andl(RAX, Immediate(2));
+  // Omitted: andl cleared the upper half of RAX.
+  __ CompareToZero(RAX, kEightBytes, /*equality=*/true);
+  __ setcc(NOT_EQUAL, AL);
+  __ addq(RAX, RCX);
+  // Not an equality, so OF from addq must not be used.
+  __ CompareToZero(RAX, kEightBytes, /*equality=*/false);
+  __ setcc(GREATER, CL);
+  __ addq(RAX, RCX);
+  __ Bind(&join);
+  // Not omitted: control may reach [join] from elsewhere.
+  __ CompareToZero(RAX, kEightBytes, /*equality=*/true);
+  __ ret();
+}
+
+ASSEMBLER_TEST_RUN(CompareToZero, test) {
+  typedef int64_t (*CompareToZero)();
+  EXPECT_EQ(3, reinterpret_cast<CompareToZero>(test->entry())());
+  EXPECT_DISASSEMBLY(
+      "movl rcx,1\n"
+      "subq rcx,1\n"
+      "setz cl\n"
+      "movq rax,-1\n"
+      "andl rax,2\n"
+      "setnz al\n"
+      "addq rax,rcx\n"
+      "testq rax,rax\n"
+      "setg cl\n"
+      "addq rax,rcx\n"
+      "testq rax,rax\n"
+      "ret\n");
+}
+
 ASSEMBLER_TEST_GENERATE(LogicalOps, assembler) {
   Label donetest1;
   __ movl(RAX, Immediate(4));
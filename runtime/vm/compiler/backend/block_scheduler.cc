@@ -7,10 +7,17 @@
 #include "vm/allocation.h"
 #include "vm/code_patcher.h"
 #include "vm/compiler/backend/flow_graph.h"
+#include "vm/compiler/backend/loops.h"
 #include "vm/compiler/jit/compiler.h"
 
 namespace dart {
 
+DEFINE_FLAG(bool,
+            aot_chain_block_layout,
+            false,
+            "Lay out blocks of AOT code by chaining the likeliest edges, "
+            "estimated with static branch heuristics.");
+
 static intptr_t GetEdgeCount(const Array& edge_counters, intptr_t edge_id) {
   if (!FLAG_reorder_basic_blocks) {
     // Assume everything was visited once.
@@ -167,7 +174,10 @@ void BlockScheduler::ReorderBlocks(FlowGraph* flow_graph) {
   }
 }
 
-void BlockScheduler::ReorderBlocksJIT(FlowGraph* flow_graph) {
+// Lays out blocks by merging chains of blocks along the heaviest edges first.
+// Edge weights are read from TargetEntry and Goto instructions. Chains whose
+// first block is in [deferred] (by postorder number) are placed last.
+static void LayOutChains(FlowGraph* flow_graph, const BitVector* deferred) {
   // Add every block to a chain of length 1 and compute a list of edges
   // sorted by weight.
   intptr_t block_count = flow_graph->preorder().length();
@@ -229,15 +239,30 @@ void BlockScheduler::ReorderBlocksJIT(FlowGraph* flow_graph) {
   // Note: the resulting order is not topologically sorted and can't be
   // used a replacement for reverse_postorder in algorithms that expect
   // topological sort.
+  auto add_chain = [&](Chain* chain) {
+    for (Link* link = chain->first; link != nullptr; link = link->next) {
+      if ((link->block != checked_entry) && (link->block != graph_entry)) {
+        flow_graph->CodegenBlockOrder()->Add(link->block);
+      }
+    }
+  };
+  GrowableArray<Chain*> deferred_chains;
   for (intptr_t i = block_count - 1; i >= 0; --i) {
     if (chains[i]->first->block == flow_graph->postorder()[i]) {
-      for (Link* link = chains[i]->first; link != nullptr; link = link->next) {
-        if ((link->block != checked_entry) && (link->block != graph_entry)) {
-          flow_graph->CodegenBlockOrder()->Add(link->block);
-        }
+      if ((deferred != nullptr) && deferred->Contains(i)) {
+        deferred_chains.Add(chains[i]);
+      } else {
+        add_chain(chains[i]);
       }
     }
   }
+  for (intptr_t i = 0; i < deferred_chains.length(); ++i) {
+    add_chain(deferred_chains[i]);
+  }
+}
+
+void BlockScheduler::ReorderBlocksJIT(FlowGraph* flow_graph) {
+  LayOutChains(flow_graph, /*deferred=*/nullptr);
 }
 
 // AOT block order is based on reverse post order but with two changes:
@@ -385,7 +410,194 @@ class AOTBlockScheduler {
 };
 }  // namespace
 
+// Static estimate of edge weights for AOT code, which has no edge counters.
+//
+// Blocks which always throw or call a function marked with
+// @pragma('vm:unlikely'), and blocks all of whose successors are such blocks,
+// are *cold*. Each branch successor gets a probability from the first of these
+// heuristics which applies:
+//
+// - a cold successor is unlikely,
+// - a successor leaving the loop of the branch is unlikely,
+// - the successor taken when a value is null is unlikely.
+//
+// Block frequencies follow in reverse postorder, with each loop body taken to
+// run kLoopIterations times per entry. The weight of an edge is the frequency
+// of its source times its probability, like the edge counts the JIT uses.
+namespace {
+class StaticEdgeWeights : public ValueObject {
+ public:
+  explicit StaticEdgeWeights(FlowGraph* flow_graph)
+      : flow_graph_(flow_graph),
+        block_count_(flow_graph->postorder().length()),
+        cold_(new(flow_graph->zone()) BitVector(flow_graph->zone(),
+                                                block_count_)),
+        deferred_(new(flow_graph->zone()) BitVector(flow_graph->zone(),
+                                                    block_count_)),
+        frequencies_(block_count_) {
+    frequencies_.FillWith(0.0, 0, block_count_);
+  }
+
+  // Sets the weight of every edge and returns the blocks (by postorder
+  // number) which should be placed after all others: cold blocks and blocks
+  // with a low estimated frequency.
+  const BitVector* Assign() {
+    ComputeColdBlocks();
+    auto& reverse_postorder = flow_graph_->reverse_postorder();
+    for (intptr_t i = 0; i < reverse_postorder.length(); ++i) {
+      BlockEntryInstr* block = reverse_postorder[i];
+      double& frequency = FrequencyOf(block);
+      if (block->IsGraphEntry()) {
+        frequency = 1.0;
+      } else if (block->IsLoopHeader()) {
+        frequency *= kLoopIterations;
+      }
+      Instruction* last = block->last_instruction();
+      for (intptr_t j = 0; j < last->SuccessorCount(); ++j) {
+        BlockEntryInstr* successor = last->SuccessorAt(j);
+        const double weight = frequency * Probability(block, j);
+        if (auto target = successor->AsTargetEntry()) {
+          target->set_edge_weight(weight);
+        } else if (auto jump = last->AsGoto()) {
+          jump->set_edge_weight(weight);
+        }
+        // Back edges are accounted for by kLoopIterations.
+        if (successor->postorder_number() < block->postorder_number()) {
+          FrequencyOf(successor) += weight;
+        }
+      }
+      if (!IsPinned(block) &&
+          (IsCold(block) || (frequency < kColdFrequency))) {
+        deferred_->Add(block->postorder_number());
+      }
+    }
+    return deferred_;
+  }
+
+ private:
+  static constexpr double kLoopIterations = 10.0;
+  static constexpr double kColdProbability = 0.001;
+  static constexpr double kLoopExitProbability = 0.1;
+  static constexpr double kNullProbability = 0.3;
+  static constexpr double kColdFrequency = 0.01;
+
+  double& FrequencyOf(BlockEntryInstr* block) {
+    return frequencies_[block->postorder_number()];
+  }
+
+  bool IsCold(BlockEntryInstr* block) const {
+    return cold_->Contains(block->postorder_number());
+  }
+
+  static bool IsPinned(BlockEntryInstr* block) {
+    return block->IsGraphEntry() || block->IsFunctionEntry();
+  }
+
+  // Successors are visited before their blocks, except loop headers reached
+  // along back edges, which are taken to be not cold.
+  void ComputeColdBlocks() {
+    for (BlockIterator it = flow_graph_->postorder_iterator(); !it.Done();
+         it.Advance()) {
+      BlockEntryInstr* block = it.Current();
+      if (IsPinned(block)) continue;
+      Instruction* last = block->last_instruction();
+      bool is_cold = last->IsThrow() || last->IsReThrow() ||
+                     CallsUnlikelyFunction(block);
+      if (!is_cold && (last->SuccessorCount() > 0)) {
+        is_cold = true;
+        for (intptr_t i = 0; i < last->SuccessorCount(); ++i) {
+          is_cold = is_cold && IsCold(last->SuccessorAt(i));
+        }
+      }
+      if (is_cold) {
+        cold_->Add(block->postorder_number());
+      }
+    }
+  }
+
+  static bool CallsUnlikelyFunction(BlockEntryInstr* block) {
+    for (ForwardInstructionIterator it(block); !it.Done(); it.Advance()) {
+      if (auto call = it.Current()->AsStaticCall()) {
+        const Function& function = call->function();
+        if (function.has_pragma() &&
+            Library::FindPragma(Thread::Current(), /*only_core=*/false,
+                                function, Symbols::vm_unlikely())) {
+          return true;
+        }
+      }
+    }
+    return false;
+  }
+
+  static bool IsNullTest(ConditionInstr* condition) {
+    ComparisonInstr* comparison = condition->AsComparison();
+    if (comparison == nullptr) return false;
+    if (!Token::IsEqualityOperator(comparison->kind())) return false;
+    return comparison->left()->BindsToConstantNull() ||
+           comparison->right()->BindsToConstantNull();
+  }
+
+  // The probability of leaving [block] through its successor at [index].
+  double Probability(BlockEntryInstr* block, intptr_t index) const {
+    Instruction* last = block->last_instruction();
+    BlockEntryInstr* successor = last->SuccessorAt(index);
+    if (BranchInstr* branch = last->AsBranch()) {
+      BlockEntryInstr* other = last->SuccessorAt(1 - index);
+      if (IsCold(successor) != IsCold(other)) {
+        return IsCold(successor) ? kColdProbability : 1.0 - kColdProbability;
+      }
+      if (LoopInfo* loop = block->loop_info()) {
+        const bool exits = !loop->Contains(successor);
+        if (exits != !loop->Contains(other)) {
+          return exits ? kLoopExitProbability : 1.0 - kLoopExitProbability;
+        }
+      }
+      ConditionInstr* condition = branch->condition();
+      if (IsNullTest(condition)) {
+        const bool is_null =
+            (successor == branch->true_successor()) ==
+            ((condition->kind() == Token::kEQ) ||
+             (condition->kind() == Token::kEQ_STRICT));
+        return is_null ? kNullProbability : 1.0 - kNullProbability;
+      }
+      return 0.5;
+    }
+    // Graph and try entries, indirect gotos: catch blocks are unlikely and
+    // all other successors equally likely.
+    if (successor->IsCatchBlockEntry()) {
+      return kColdProbability;
+    }
+    intptr_t count = 0;
+    for (intptr_t i = 0; i < last->SuccessorCount(); ++i) {
+      if (!last->SuccessorAt(i)->IsCatchBlockEntry()) ++count;
+    }
+    return 1.0 / count;
+  }
+
+  FlowGraph* const flow_graph_;
+  const intptr_t block_count_;
+
+  // Blocks which are cold, by postorder number.
+  BitVector* const cold_;
+
+  // Blocks to place after all others, by postorder number.
+  BitVector* const deferred_;
+
+  // Estimated block frequencies relative to the function entry, by postorder
+  // number.
+  GrowableArray<double> frequencies_;
+};
+}  // namespace
+
 void BlockScheduler::ReorderBlocksAOT(FlowGraph* flow_graph) {
+  // Both layouts use the loop information of blocks, which is stale if the
+  // blocks were rediscovered since it was last computed.
+  flow_graph->GetLoopHierarchy();
+  if (FLAG_aot_chain_block_layout) {
+    StaticEdgeWeights weights(flow_graph);
+    LayOutChains(flow_graph, weights.Assign());
+    return;
+  }
   AOTBlockScheduler(flow_graph).ComputeOrder();
 }
 
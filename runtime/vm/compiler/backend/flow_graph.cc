@@ -2222,10 +2222,34 @@ void FlowGraph::InsertRecordBoxing(Definition* def) {
       ExtractNthOutputInstr(new (Z) Value(def), 0, kTagged, kDynamicCid);
   auto* y = new (Z)
       ExtractNthOutputInstr(new (Z) Value(def), 1, kTagged, kDynamicCid);
-  auto* alloc = new (Z)
-      AllocateSmallRecordInstr(InstructionSource(), shape, new (Z) Value(x),
-                               new (Z) Value(y), nullptr, def->deopt_id());
-  def->ReplaceUsesWith(alloc);
+
+  // Loads of record fields can take the field values straight from the
+  // call, so that the record is only allocated if it escapes.
+  const intptr_t field0_offset = compiler::target::Record::field_offset(0);
+  const intptr_t field1_offset = compiler::target::Record::field_offset(1);
+  for (Value* use = def->input_use_list(); use != nullptr;) {
+    Value* next = use->next_use();
+    LoadFieldInstr* load = use->instruction()->AsLoadField();
+    if ((load != nullptr) && load->slot().IsRecordField()) {
+      ASSERT(use->use_index() == 0);
+      const intptr_t offset = load->slot().offset_in_bytes();
+      if (offset == field0_offset || offset == field1_offset) {
+        load->ReplaceUsesWith(offset == field0_offset ? x : y);
+        // 'load' is dominated by 'def' and has not been visited by
+        // SelectRepresentations yet, so it can be removed right away.
+        load->RemoveFromGraph();
+      }
+    }
+    use = next;
+  }
+
+  AllocateSmallRecordInstr* alloc = nullptr;
+  if (NeedsRecordBoxing(def)) {
+    alloc = new (Z)
+        AllocateSmallRecordInstr(InstructionSource(), shape, new (Z) Value(x),
+                                 new (Z) Value(y), nullptr, def->deopt_id());
+    def->ReplaceUsesWith(alloc);
+  }
   // Uses of 'def' in 'x' and 'y' should not be replaced as 'x' and 'y'
   // are not added to the flow graph yet.
   ASSERT(x->value()->definition() == def);
@@ -2234,7 +2258,9 @@ void FlowGraph::InsertRecordBoxing(Definition* def) {
   ASSERT(insert_before != nullptr);
   InsertBefore(insert_before, x, nullptr, FlowGraph::kValue);
   InsertBefore(insert_before, y, nullptr, FlowGraph::kValue);
-  InsertBefore(insert_before, alloc, def->env(), FlowGraph::kValue);
+  if (alloc != nullptr) {
+    InsertBefore(insert_before, alloc, def->env(), FlowGraph::kValue);
+  }
 }
 
 void FlowGraph::InsertConversionsFor(Definition* def) {
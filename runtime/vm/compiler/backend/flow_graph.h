@@ -721,7 +721,9 @@ class FlowGraph : public ZoneAllocated {
                         bool is_environment_use);
 
   // Insert allocation of a record instance for [def]
-  // which returns an unboxed record.
+  // which returns an unboxed record. Loads of record fields from [def]
+  // are replaced with the unboxed fields, and the record is not allocated
+  // if nothing else needs it.
   void InsertRecordBoxing(Definition* def);
 
   void ComputeIsReceiver(PhiInstr* phi) const;
@@ -10,6 +10,7 @@
 #include "vm/bootstrap.h"
 #include "vm/code_entry_kind.h"
 #include "vm/compiler/aot/dispatch_table_generator.h"
+#include "vm/compiler/aot/precompiler.h"
 #include "vm/compiler/assembler/object_pool_builder.h"
 #include "vm/compiler/backend/code_statistics.h"
 #include "vm/compiler/backend/constant_propagator.h"
@@ -3762,7 +3763,11 @@ Instruction* CheckClassInstr::Canonicalize(FlowGraph* flow_graph) {
     return this;
   }
 
-  return cids().HasClassId(value_cid) ? nullptr : this;
+  if (!cids().HasClassId(value_cid)) {
+    return this;
+  }
+  Precompiler::CountRemovedCheck(this, value());
+  return nullptr;
 }
 
 Definition* LoadClassIdInstr::Canonicalize(FlowGraph* flow_graph) {
@@ -3951,7 +3956,11 @@ Instruction* CheckEitherNonSmiInstr::Canonicalize(FlowGraph* flow_graph) {
 }
 
 Definition* CheckNullInstr::Canonicalize(FlowGraph* flow_graph) {
-  return (!value()->Type()->is_nullable()) ? value()->definition() : this;
+  if (value()->Type()->is_nullable()) {
+    return this;
+  }
+  Precompiler::CountRemovedCheck(this, value());
+  return value()->definition();
 }
 
 bool CheckNullInstr::AttributesEqual(const Instruction& other) const {
@@ -6717,7 +6726,11 @@ bool CheckArrayBoundInstr::IsFixedLengthArrayType(intptr_t cid) {
 }
 
 Definition* CheckBoundBaseInstr::Canonicalize(FlowGraph* flow_graph) {
-  return IsRedundant() ? index()->definition() : this;
+  if (!IsRedundant()) {
+    return this;
+  }
+  Precompiler::CountRemovedCheck(this, index());
+  return index()->definition();
 }
 
 intptr_t CheckArrayBoundInstr::LengthOffsetFor(intptr_t class_id) {
@@ -5638,6 +5638,7 @@ class StaticCallInstr : public TemplateDartCall<0> {
   DECLARE_ATTRIBUTE(&function())
 
   virtual CompileType ComputeType() const;
+  virtual void InferRange(RangeAnalysis* analysis, Range* range);
   virtual Definition* Canonicalize(FlowGraph* flow_graph);
   bool Evaluate(FlowGraph* flow_graph, const Object& argument, Object* result);
   bool Evaluate(FlowGraph* flow_graph,
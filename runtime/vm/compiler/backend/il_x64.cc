@@ -34,6 +34,8 @@
 
 namespace dart {
 
+DECLARE_FLAG(bool, compare_to_zero_peephole);
+
 // Generic summary for call instructions that have all arguments pushed
 // on the stack and return the result in a fixed register RAX (or XMM0 if
 // the return type is double).
@@ -909,7 +911,12 @@ static Condition EmitUnboxedIntComparisonOp(FlowGraphCompiler* compiler,
     int64_t value;
     const bool ok = compiler::HasIntegerValue(right.constant(), &value);
     RELEASE_ASSERT(ok);
-    if (rep == kUnboxedInt64) {
+    if (FLAG_compare_to_zero_peephole && value == 0) {
+      __ CompareToZero(left.reg(),
+                       rep == kUnboxedInt64 ? compiler::kEightBytes
+                                            : compiler::kFourBytes,
+                       /*equality=*/kind == Token::kEQ || kind == Token::kNE);
+    } else if (rep == kUnboxedInt64) {
       __ cmpq(left.reg(), compiler::Immediate(value));
     } else {
       if (rep == kUnboxedUint32) {
@@ -2864,6 +2871,16 @@ void CheckStackOverflowInstr::EmitNativeCode(FlowGraphCompiler* compiler) {
   compiler->AddSlowPathCode(slow_path);
 
   Register temp = locs()->temp(0).reg();
+  if (FLAG_use_safepoint_poll_page && compiler->is_optimizing() &&
+      in_loop() && !compiler->ForceSlowPathForStackOverflow()) {
+    // Loop checks only look for interrupts (the stack cannot grow inside the
+    // loop without a call, which has its own check). The load below faults
+    // while one is pending and the fault handler resumes at the slow path.
+    __ movq(TMP, compiler::Address(THR, Thread::safepoint_poll_page_offset()));
+    __ SafepointPoll(slow_path->entry_label());
+    __ Bind(slow_path->exit_label());
+    return;
+  }
   // Generate stack overflow check.
   __ cmpq(RSP, compiler::Address(THR, Thread::stack_limit_offset()));
   __ j(BELOW_EQUAL, slow_path->entry_label());
@@ -19,12 +19,14 @@
 #include "vm/compiler/jit/compiler.h"
 #include "vm/compiler/jit/jit_call_specializer.h"
 #include "vm/compiler/method_recognizer.h"
+#include "vm/dart.h"
 #include "vm/flags.h"
 #include "vm/kernel.h"
 #include "vm/log.h"
 #include "vm/longjump.h"
 #include "vm/object.h"
 #include "vm/object_store.h"
+#include "vm/os.h"
 
 namespace dart {
 
@@ -79,6 +81,22 @@ DEFINE_FLAG(int,
             500,
             "Max. number of inlined calls per depth");
 DEFINE_FLAG(bool, print_inlining_tree, false, "Print inlining tree");
+DEFINE_FLAG(bool,
+            inlining_cost_model,
+            false,
+            "In AOT, inline callees above --inlining-size-threshold only if "
+            "the estimated benefit of the call site pays for their size and "
+            "the growth budget of the caller allows it.");
+DEFINE_FLAG(int,
+            inlining_growth_budget,
+            30,
+            "With --inlining-cost-model, how much inlining callees above "
+            "--inlining-size-threshold may grow each function, in percent of "
+            "its size before inlining.");
+DEFINE_FLAG(charp,
+            inlining_decisions_log_to,
+            nullptr,
+            "In AOT, write every inlining decision as JSON to the given file.");
 
 DECLARE_FLAG(int, max_deoptimization_counter_threshold);
 DECLARE_FLAG(bool, print_flow_graph);
@@ -257,6 +275,109 @@ static intptr_t AotCallCountApproximation(intptr_t nesting_depth) {
   }
 }
 
+// Estimated instructions saved per argument that is a constant in the
+// caller, per call that no longer needs a dispatch, and per allocation that
+// only escapes into the callee and may be sunk once it is inlined.
+static constexpr intptr_t kConstantArgumentBenefit = 4;
+static constexpr intptr_t kDevirtualizationBenefit = 8;
+static constexpr intptr_t kSinkableAllocationBenefit = 12;
+// Instructions saved by every inlined call: pushing the arguments, the call
+// itself and dropping the arguments.
+static intptr_t CallInstructionCount(intptr_t argument_count) {
+  return argument_count + 1 + 1;
+}
+
+bool InliningCostModel::IsEnabled() {
+  return FLAG_inlining_cost_model ||
+         (FLAG_inlining_decisions_log_to != nullptr);
+}
+
+bool InliningCostModel::DecidesInlining() {
+  return FLAG_inlining_cost_model;
+}
+
+void InliningCostModel::Init() {
+  const char* filename = FLAG_inlining_decisions_log_to;
+  if (filename == nullptr) return;
+  if ((Dart::file_write_callback() == nullptr) ||
+      (Dart::file_open_callback() == nullptr) ||
+      (Dart::file_close_callback() == nullptr)) {
+    OS::PrintErr("warning: Could not access file callbacks.\n");
+    return;
+  }
+  log_file_ = Dart::file_open_callback()(filename, /*write=*/true);
+  if (log_file_ == nullptr) {
+    OS::PrintErr("warning: Failed to write inlining decisions: %s\n",
+                 filename);
+    return;
+  }
+  log_.AddString("{\"decisions\":[");
+}
+
+void InliningCostModel::WriteLog() {
+  if (log_file_ == nullptr) return;
+  log_.Printf("],\"callerSize\":%" Pd ",\"inlinedGrowth\":%" Pd "}\n",
+              caller_size_, inlined_growth_);
+  Dart::file_write_callback()(log_.buffer(), log_.length(), log_file_);
+  Dart::file_close_callback()(log_file_);
+  log_file_ = nullptr;
+}
+
+void InliningCostModel::BeginCaller(intptr_t size) {
+  caller_size_ += size;
+  current_budget_ =
+      size * Utils::Maximum(FLAG_inlining_growth_budget, 0) / 100;
+  current_growth_ = 0;
+}
+
+void InliningCostModel::ConsumeBudget(intptr_t growth) {
+  current_growth_ += growth;
+  inlined_growth_ += growth;
+}
+
+intptr_t InliningCostModel::RemainingBudget() const {
+  return current_budget_ - current_growth_;
+}
+
+bool InliningCostModel::FitsBudget(intptr_t growth) const {
+  return growth <= RemainingBudget();
+}
+
+void InliningCostModel::LogDecision(const Function& caller,
+                                    const Function& callee,
+                                    const Definition* call,
+                                    intptr_t inlining_depth,
+                                    intptr_t instruction_count,
+                                    intptr_t call_site_count,
+                                    intptr_t constant_arg_count,
+                                    intptr_t sinkable_allocation_count,
+                                    intptr_t benefit,
+                                    bool inlined,
+                                    const char* reason) {
+  if (log_file_ == nullptr) return;
+  if (has_decisions_) log_.AddChar(',');
+  has_decisions_ = true;
+  log_.AddString("{\"caller\":\"");
+  log_.AddEscapedString(caller.ToFullyQualifiedCString());
+  log_.AddString("\",\"callee\":\"");
+  log_.AddEscapedString(callee.ToFullyQualifiedCString());
+  log_.AddString("\",\"call\":\"");
+  log_.AddEscapedString(call->DebugName());
+  log_.Printf("\",\"depth\":%" Pd ",\"size\":%" Pd ",\"callSites\":%" Pd
+              ",\"constantArgs\":%" Pd ",\"sinkableAllocations\":%" Pd
+              ",\"benefit\":%" Pd ",\"remainingBudget\":%" Pd
+              ",\"inlined\":%s",
+              inlining_depth, instruction_count, call_site_count,
+              constant_arg_count, sinkable_allocation_count, benefit,
+              RemainingBudget(), inlined ? "true" : "false");
+  if (reason != nullptr) {
+    log_.AddString(",\"reason\":\"");
+    log_.AddEscapedString(reason);
+    log_.AddChar('"');
+  }
+  log_.AddChar('}');
+}
+
 // A collection of call sites to consider for inlining.
 class CallSites : public ValueObject {
  public:
@@ -1020,9 +1141,16 @@ class CallSiteInliner : public ValueObject {
   };
 
   // Inlining heuristics based on Cooper et al. 2008.
+  //
+  // With --inlining-cost-model callees above --inlining-size-threshold are
+  // instead weighed against the estimated [benefit] of their call site (see
+  // EstimateBenefit) and the growth budget of the caller.
   InliningDecision ShouldWeInline(const Function& callee,
                                   intptr_t instr_count,
-                                  intptr_t call_site_count) {
+                                  intptr_t call_site_count,
+                                  intptr_t benefit) {
+    const bool use_cost_model =
+        (cost_model() != nullptr) && InliningCostModel::DecidesInlining();
     // Pragma or size heuristics.
     if (inliner_->AlwaysInline(callee)) {
       return InliningDecision::Yes("AlwaysInline");
@@ -1033,9 +1161,13 @@ class CallSiteInliner : public ValueObject {
       // Prevent inlining of callee methods that exceed certain size.
       return InliningDecision::No("--inlining-callee-size-threshold");
     }
-    // Inlining depth.
+    // Inlining depth. The cost model lets small wrappers through, as they
+    // rarely grow the caller and often forward to the call worth inlining.
     const int callee_inlining_depth = callee.inlining_depth();
-    if (callee_inlining_depth > 0 &&
+    const bool is_small_wrapper =
+        use_cost_model && (instr_count != 0) &&
+        (instr_count <= FLAG_inlining_size_threshold) && (call_site_count <= 1);
+    if (callee_inlining_depth > 0 && !is_small_wrapper &&
         ((callee_inlining_depth + inlining_depth_) >
          FLAG_inlining_depth_threshold)) {
       return InliningDecision::No("--inlining-depth-threshold");
@@ -1047,12 +1179,64 @@ class CallSiteInliner : public ValueObject {
       return InliningDecision::Yes("need to count first");
     } else if (instr_count <= FLAG_inlining_size_threshold) {
       return InliningDecision::Yes("--inlining-size-threshold");
+    } else if (use_cost_model) {
+      if (instr_count > FLAG_inlining_size_threshold + benefit) {
+        return InliningDecision::No("--inlining-cost-model");
+      } else if (!cost_model()->FitsBudget(instr_count - benefit)) {
+        return InliningDecision::No("--inlining-growth-budget");
+      }
+      return InliningDecision::Yes("--inlining-cost-model");
     } else if (call_site_count <= FLAG_inlining_callee_call_sites_threshold) {
       return InliningDecision::Yes("--inlining-callee-call-sites-threshold");
     }
     return InliningDecision::No("default");
   }
 
+  InliningCostModel* cost_model() const { return inliner_->cost_model(); }
+
+  // Estimates how many instructions inlining the call in [call_data] saves
+  // besides the callee's body: the call sequence itself, folding of constant
+  // arguments, the dispatch of calls that were not static and allocations
+  // that only escape into the callee, which allocation sinking may remove
+  // once the callee is inlined.
+  intptr_t EstimateBenefit(InlinedCallData* call_data,
+                           intptr_t constant_arg_count,
+                           intptr_t* sinkable_allocation_count) {
+    GrowableArray<Value*>* arguments = call_data->arguments;
+    intptr_t sinkable = 0;
+    for (intptr_t i = 0; i < arguments->length(); ++i) {
+      Value* argument = (*arguments)[i];
+      Definition* definition = argument->definition();
+      if (definition->IsAllocation() &&
+          definition->HasOnlyInputUse(argument)) {
+        ++sinkable;
+      }
+    }
+    *sinkable_allocation_count = sinkable;
+    intptr_t benefit = CallInstructionCount(arguments->length()) +
+                       constant_arg_count * kConstantArgumentBenefit +
+                       sinkable * kSinkableAllocationBenefit;
+    if (!call_data->call->IsStaticCall()) {
+      benefit += kDevirtualizationBenefit;
+    }
+    return benefit;
+  }
+
+  void LogDecision(InlinedCallData* call_data,
+                   const Function& callee,
+                   intptr_t instruction_count,
+                   intptr_t call_site_count,
+                   intptr_t constant_arg_count,
+                   intptr_t sinkable_allocation_count,
+                   intptr_t benefit,
+                   const InliningDecision& decision) {
+    if (cost_model() == nullptr) return;
+    cost_model()->LogDecision(
+        call_data->caller, callee, call_data->call, inlining_depth_,
+        instruction_count, call_site_count, constant_arg_count,
+        sinkable_allocation_count, benefit, decision.value, decision.reason);
+  }
+
   void InlineCalls() {
     // If inlining depth is less than one abort.
     if (inlining_depth_threshold_ < 1) return;
@@ -1232,9 +1416,15 @@ class CallSiteInliner : public ValueObject {
         constant_arg_count == 0 ? function.optimized_instruction_count() : 0;
     const intptr_t call_site_count =
         constant_arg_count == 0 ? function.optimized_call_site_count() : 0;
+    intptr_t sinkable_allocation_count = 0;
+    const intptr_t benefit = EstimateBenefit(call_data, constant_arg_count,
+                                             &sinkable_allocation_count);
     volatile InliningDecision decision =
-        ShouldWeInline(function, instruction_count, call_site_count);
+        ShouldWeInline(function, instruction_count, call_site_count, benefit);
     if (!decision.value) {
+      LogDecision(call_data, function, instruction_count, call_site_count,
+                  constant_arg_count, sinkable_allocation_count, benefit,
+                  InliningDecision::No(decision.reason));
       TRACE_INLINING(
           THR_Print("     Bailout: early heuristics (%s) with "
                     "code size:  %" Pd ", "
@@ -1460,9 +1650,12 @@ class CallSiteInliner : public ValueObject {
         // Use heuristics do decide if this call should be inlined.
         {
           COMPILER_TIMINGS_TIMER_SCOPE(thread(), MakeInliningDecision);
-          InliningDecision decision =
-              ShouldWeInline(function, instruction_count, call_site_count);
+          InliningDecision decision = ShouldWeInline(
+              function, instruction_count, call_site_count, benefit);
           if (!decision.value) {
+            LogDecision(call_data, function, instruction_count,
+                        call_site_count, constants_count,
+                        sinkable_allocation_count, benefit, decision);
             // If size is larger than all thresholds, don't consider it again.
 
             // TODO(dartbug.com/49665): Make compiler smart enough so it itself
@@ -1531,6 +1724,19 @@ class CallSiteInliner : public ValueObject {
         // Build succeeded so we restore the bailout jump.
         inlined_ = true;
         inlined_size_ += instruction_count;
+        if (cost_model() != nullptr) {
+          // Callees within the size threshold and those which must be
+          // inlined do not depend on the budget, so they are not charged.
+          if (InliningCostModel::DecidesInlining() &&
+              (instruction_count > FLAG_inlining_size_threshold) &&
+              !inliner_->AlwaysInline(function)) {
+            cost_model()->ConsumeBudget(
+                Utils::Maximum<intptr_t>(0, instruction_count - benefit));
+          }
+          LogDecision(call_data, function, instruction_count, call_site_count,
+                      constants_count, sinkable_allocation_count, benefit,
+                      InliningDecision::Yes(decision.reason));
+        }
         if (is_recursive_call) {
           inlined_recursive_call_ = true;
         }
@@ -2563,6 +2769,10 @@ int FlowGraphInliner::Inline() {
 
   intptr_t inlining_depth_threshold = FLAG_inlining_depth_threshold;
 
+  if (cost_model() != nullptr) {
+    cost_model()->BeginCaller(instruction_count);
+  }
+
   CallSiteInliner inliner(this, inlining_depth_threshold);
   inliner.InlineCalls();
   if (FLAG_print_inlining_tree) {
@@ -2585,6 +2795,11 @@ int FlowGraphInliner::Inline() {
   return inliner.inlining_depth();
 }
 
+InliningCostModel* FlowGraphInliner::cost_model() const {
+  return precompiler_ != nullptr ? precompiler_->inlining_cost_model()
+                                 : nullptr;
+}
+
 intptr_t FlowGraphInliner::NextInlineId(const Function& function,
                                         const InstructionSource& source) {
   const intptr_t id = inline_id_to_function_->length();
@@ -11,6 +11,7 @@
 
 #include "vm/allocation.h"
 #include "vm/growable_array.h"
+#include "vm/zone_text_buffer.h"
 #include "vm/token_position.h"
 
 namespace dart {
@@ -30,6 +31,66 @@ class Precompiler;
 class StaticCallInstr;
 class TargetEntryInstr;
 
+// Program-wide state of the AOT inliner cost model (--inlining_cost_model):
+// the code growth budget and the machine-readable log of inlining decisions
+// (--inlining_decisions_log_to).
+//
+// Like PrecompilerTracer it is zone allocated: compilation errors long jump
+// past its owner, so nothing may depend on it being destructed. The log is
+// kept in the zone for the same reason and written out by WriteLog.
+class InliningCostModel : public ZoneAllocated {
+ public:
+  explicit InliningCostModel(Zone* zone) : log_(zone) {}
+
+  // Whether the precompiler should create a cost model at all.
+  static bool IsEnabled();
+  // Whether decisions are made by the cost model rather than just logged.
+  static bool DecidesInlining();
+
+  // Opens the decisions log if one was requested.
+  void Init();
+  // Finishes and writes the decisions log.
+  void WriteLog();
+
+  // Starts inlining into a function of [size] instructions, measured before
+  // anything was inlined into it.
+  void BeginCaller(intptr_t size);
+
+  // Whether the current caller may grow by another [growth] instructions.
+  // Every caller gets --inlining_growth_budget percent of its own size, so
+  // a decision does not depend on the order functions are compiled in and
+  // the whole program still grows by at most that percentage. Only callees
+  // above --inlining-size-threshold are charged to it.
+  bool FitsBudget(intptr_t growth) const;
+  void ConsumeBudget(intptr_t growth);
+  intptr_t RemainingBudget() const;
+
+  void LogDecision(const Function& caller,
+                   const Function& callee,
+                   const Definition* call,
+                   intptr_t inlining_depth,
+                   intptr_t instruction_count,
+                   intptr_t call_site_count,
+                   intptr_t constant_arg_count,
+                   intptr_t sinkable_allocation_count,
+                   intptr_t benefit,
+                   bool inlined,
+                   const char* reason);
+
+ private:
+  // Totals over all callers, reported in the log.
+  intptr_t caller_size_ = 0;
+  intptr_t inlined_growth_ = 0;
+  // Budget of the function currently being inlined into.
+  intptr_t current_budget_ = 0;
+  intptr_t current_growth_ = 0;
+  void* log_file_ = nullptr;
+  bool has_decisions_ = false;
+  ZoneTextBuffer log_;
+
+  DISALLOW_COPY_AND_ASSIGN(InliningCostModel);
+};
+
 class FlowGraphInliner : ValueObject {
  public:
   FlowGraphInliner(FlowGraph* flow_graph, Precompiler* precompiler);
@@ -69,6 +130,10 @@ class FlowGraphInliner : ValueObject {
 
   bool trace_inlining() const { return trace_inlining_; }
 
+  // The program-wide cost model, or nullptr outside of AOT compilation or if
+  // it is not enabled.
+  InliningCostModel* cost_model() const;
+
  private:
   friend class CallSiteInliner;
 
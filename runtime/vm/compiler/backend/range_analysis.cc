@@ -5,6 +5,7 @@
 #include "vm/compiler/backend/range_analysis.h"
 
 #include "vm/bit_vector.h"
+#include "vm/compiler/aot/precompiler.h"
 #include "vm/compiler/backend/il_printer.h"
 #include "vm/compiler/backend/loops.h"
 
@@ -14,6 +15,11 @@ DEFINE_FLAG(bool,
             array_bounds_check_elimination,
             true,
             "Eliminate redundant bounds checks.");
+DEFINE_FLAG(bool,
+            narrow_loop_bounds,
+            false,
+            "Remove bounds checks on loop induction variables from loop bodies "
+            "in AOT code by narrowing the loop condition.");
 DEFINE_FLAG(bool, trace_range_analysis, false, "Trace range analysis progress");
 DEFINE_FLAG(bool,
             trace_integer_ir_selection,
@@ -73,6 +79,11 @@ void RangeAnalysis::Analyze() {
   iis.Select();
 
   RemoveConstraints();
+
+  if (FLAG_narrow_loop_bounds && FLAG_array_bounds_check_elimination &&
+      CompilerState::Current().is_aot()) {
+    NarrowLoopBounds();
+  }
 }
 
 // Helper method to chase to a constrained definition.
@@ -1321,6 +1332,236 @@ class BoundsCheckGeneralizer {
   Scheduler scheduler_;
 };
 
+// In AOT code a bounds check can't be hoisted out of a loop by
+// deoptimizing when the hoisted check fails, and cloning the loop into
+// checked and unchecked versions is not supported by the IL. Instead, for
+//
+//     for (i = start; i < end; i++) {
+//       check(i < length);
+//       ...
+//     }
+//
+// with start >= 0 and loop invariant end and length, the loop condition is
+// narrowed and the check is moved to the loop exit:
+//
+//     for (i = start; i < min(end, length); i++) {
+//       ...
+//     }
+//     if (i < end) check(i < length);  // Always throws.
+//
+// If every iteration reaches the check without side effects, the iteration
+// that would have thrown is indistinguishable from leaving the loop, so the
+// RangeError is thrown with the same index at the same point.
+//
+// The transformation adds no code to the loop, and just a branch and a check
+// on its exit.
+class LoopBoundsNarrowing : public ValueObject {
+ public:
+  explicit LoopBoundsNarrowing(FlowGraph* flow_graph)
+      : flow_graph_(flow_graph), candidates_(4) {}
+
+  void TryCollect(LoopInfo* loop) {
+    Candidate candidate;
+    if (Match(loop, &candidate)) {
+      TRACE_RANGE_ANALYSIS(
+          THR_Print("Narrowing bounds of loop B%" Pd " to remove %s\n",
+                    loop->header()->block_id(),
+                    candidate.check->ToCString()));
+      candidates_.Add(candidate);
+    }
+  }
+
+  // Rewrites all collected loops. Returns true if the graph was changed.
+  bool Apply() {
+    for (const Candidate& candidate : candidates_) {
+      Rewrite(candidate);
+    }
+    return !candidates_.is_empty();
+  }
+
+ private:
+  struct Candidate {
+    BranchInstr* branch = nullptr;
+    RelationalOpInstr* compare = nullptr;
+    PhiInstr* index = nullptr;
+    Definition* end = nullptr;
+    GenericCheckBoundInstr* check = nullptr;
+    GotoInstr* pre_header_goto = nullptr;
+  };
+
+  static bool IsInvariant(LoopInfo* loop, Definition* def) {
+    return !loop->Contains(def->GetBlock());
+  }
+
+  // Returns true if executing [instr] can't be observed or interrupted,
+  // apart from stack overflow checks which are safe to keep running.
+  static bool IsTransparent(Instruction* instr) {
+    return instr->IsCheckStackOverflow() ||
+           !(instr->HasUnknownSideEffects() || instr->CanDeoptimize() ||
+             instr->MayThrow() || instr->MayHaveVisibleEffect());
+  }
+
+  bool Match(LoopInfo* loop, Candidate* candidate) {
+    JoinEntryInstr* header = loop->header()->AsJoinEntry();
+    if ((header == nullptr) || (header->try_index() != kInvalidTryIndex) ||
+        (loop->back_edges().length() != 1) ||
+        (header->PredecessorCount() != 2)) {
+      return false;
+    }
+
+    // The loop is controlled by i < end in its header.
+    BranchInstr* branch = header->last_instruction()->AsBranch();
+    if (branch == nullptr) return false;
+    RelationalOpInstr* compare = branch->condition()->AsRelationalOp();
+    if ((compare == nullptr) || (compare->kind() != Token::kLT) ||
+        (compare->input_representation() != kUnboxedInt64)) {
+      return false;
+    }
+    TargetEntryInstr* body = branch->true_successor();
+    TargetEntryInstr* exit = branch->false_successor();
+    if (!loop->Contains(body) || loop->Contains(exit)) return false;
+
+    PhiInstr* index = compare->left()->definition()->AsPhi();
+    Definition* end = compare->right()->definition();
+    if ((index == nullptr) || (index->block() != header) ||
+        (index->representation() != kUnboxedInt64) ||
+        (end->representation() != kUnboxedInt64) || !IsInvariant(loop, end)) {
+      return false;
+    }
+
+    // The index counts up by one from a non-negative start.
+    InductionVar* induction = loop->LookupInduction(index);
+    int64_t stride = 0;
+    if (!InductionVar::IsLinear(induction, &stride) || (stride != 1)) {
+      return false;
+    }
+    BlockEntryInstr* back_edge = loop->back_edges()[0];
+    const intptr_t pre_header_index =
+        (header->PredecessorAt(0) == back_edge) ? 1 : 0;
+    BlockEntryInstr* pre_header = header->PredecessorAt(pre_header_index);
+    GotoInstr* pre_header_goto = pre_header->last_instruction()->AsGoto();
+    if ((pre_header_goto == nullptr) || loop->Contains(pre_header)) {
+      return false;
+    }
+    Definition* start = index->InputAt(pre_header_index)->definition();
+    if (!RangeUtils::IsPositive(start->range())) return false;
+
+    // Each iteration must reach the check on i without observable effects.
+    for (Instruction* instr = header->next(); instr != branch;
+         instr = instr->next()) {
+      if (!IsTransparent(instr)) return false;
+    }
+    for (Instruction* instr = body->next(); instr != nullptr;
+         instr = instr->next()) {
+      GenericCheckBoundInstr* check = instr->AsGenericCheckBound();
+      if ((check != nullptr) && !check->IsPhantom() &&
+          (check->index()->definition() == index) &&
+          (check->length()->definition()->representation() ==
+           kUnboxedInt64) &&
+          IsInvariant(loop, check->length()->definition())) {
+        ASSERT(GenericCheckBoundInstr::UseUnboxedRepresentation());
+        candidate->branch = branch;
+        candidate->compare = compare;
+        candidate->index = index;
+        candidate->end = end;
+        candidate->check = check;
+        candidate->pre_header_goto = pre_header_goto;
+        return true;
+      }
+      if (!IsTransparent(instr)) return false;
+    }
+    return false;
+  }
+
+  void Rewrite(const Candidate& candidate) {
+    Zone* zone = flow_graph_->zone();
+    BranchInstr* branch = candidate.branch;
+    GenericCheckBoundInstr* check = candidate.check;
+    Definition* index = candidate.index;
+    Definition* end = candidate.end;
+    Definition* length = check->length()->definition();
+
+    // Loop while i < min(end, length) and drop the check from the body.
+    auto* limit = new MathMinMaxInstr(MethodRecognizer::kMathMin,
+                                      new Value(end), new Value(length),
+                                      DeoptId::kNone, kUnboxedInt64);
+    flow_graph_->InsertBefore(candidate.pre_header_goto, limit, nullptr,
+                              FlowGraph::kValue);
+    candidate.compare->right()->BindTo(limit);
+    const intptr_t deopt_id = check->deopt_id();
+    check->ReplaceUsesWith(index);
+    check->RemoveFromGraph();
+
+    // Replace the exit block with
+    //
+    //     exit:     if (i < end) goto throw; else goto skip;
+    //     throw:    check(i < length); goto continue;
+    //     skip:     goto continue;
+    //     continue: <original exit block>
+    //
+    // The join takes over the id of the original exit block so that the
+    // order of predecessors of its successors (and their phis) is kept.
+    TargetEntryInstr* old_exit = branch->false_successor();
+    const intptr_t try_index = old_exit->try_index();
+    auto* exit = new TargetEntryInstr(flow_graph_->allocate_block_id(),
+                                      try_index, DeoptId::kNone);
+    auto* throw_block = new TargetEntryInstr(flow_graph_->allocate_block_id(),
+                                             try_index, DeoptId::kNone);
+    auto* skip_block = new TargetEntryInstr(flow_graph_->allocate_block_id(),
+                                            try_index, DeoptId::kNone);
+    auto* join =
+        new JoinEntryInstr(old_exit->block_id(), try_index, DeoptId::kNone);
+
+    Instruction* first = old_exit->next();
+    Instruction* last = old_exit->last_instruction();
+    old_exit->UnuseAllInputs();
+    join->LinkTo(first);
+    join->set_last_instruction(last);
+
+    auto* exit_branch = new BranchInstr(
+        candidate.compare->CopyWithNewOperands(new Value(index),
+                                               new Value(end)),
+        DeoptId::kNone);
+    if (branch->env() != nullptr) {
+      exit_branch->InheritDeoptTarget(zone, branch);
+    }
+    exit->AppendInstruction(exit_branch);
+    exit->set_last_instruction(exit_branch);
+    *exit_branch->true_successor_address() = throw_block;
+    *exit_branch->false_successor_address() = skip_block;
+    *branch->false_successor_address() = exit;
+
+    auto* exit_check = new GenericCheckBoundInstr(
+        new Value(length), new Value(index), deopt_id);
+    auto* throw_goto = new GotoInstr(join, DeoptId::kNone);
+    throw_block->AppendInstruction(throw_goto);
+    throw_block->set_last_instruction(throw_goto);
+    flow_graph_->InsertBefore(throw_goto, exit_check, branch->env(),
+                              FlowGraph::kValue);
+
+    auto* skip_goto = new GotoInstr(join, DeoptId::kNone);
+    skip_block->AppendInstruction(skip_goto);
+    skip_block->set_last_instruction(skip_goto);
+  }
+
+  FlowGraph* flow_graph_;
+  GrowableArray<Candidate> candidates_;
+};
+
+void RangeAnalysis::NarrowLoopBounds() {
+  LoopBoundsNarrowing narrowing(flow_graph_);
+  const auto& loop_headers = flow_graph_->GetLoopHierarchy().headers();
+  for (intptr_t i = 0; i < loop_headers.length(); i++) {
+    narrowing.TryCollect(loop_headers[i]->loop_info());
+  }
+  if (narrowing.Apply()) {
+    flow_graph_->DiscoverBlocks();
+    GrowableArray<BitVector*> dominance_frontier;
+    flow_graph_->ComputeDominators(&dominance_frontier);
+    flow_graph_->ResetLoopHierarchy();
+  }
+}
+
 void RangeAnalysis::EliminateRedundantBoundsChecks() {
   if (FLAG_array_bounds_check_elimination) {
     const Function& function = flow_graph_->function();
@@ -1333,6 +1574,7 @@ void RangeAnalysis::EliminateRedundantBoundsChecks() {
     BoundsCheckGeneralizer generalizer(this, flow_graph_);
     for (CheckBoundBaseInstr* check : bounds_checks_) {
       if (check->IsRedundant(/*use_loops=*/true)) {
+        Precompiler::CountRemovedCheck(check, check->index());
         check->ReplaceUsesWith(check->index()->definition());
         check->RemoveFromGraph();
       } else if (try_generalization) {
@@ -2887,6 +3129,16 @@ void LoadFieldInstr::InferRange(RangeAnalysis* analysis, Range* range) {
   }
 }
 
+void StaticCallInstr::InferRange(RangeAnalysis* analysis, Range* range) {
+  Definition::InferRange(analysis, range);
+  const ResultSummary* summary = Precompiler::LookupResultSummary(function());
+  if ((summary != nullptr) && summary->has_range) {
+    const Range result_range(RangeBoundary::FromConstant(summary->min),
+                             RangeBoundary::FromConstant(summary->max));
+    *range = range->Intersect(&result_range);
+  }
+}
+
 void LoadIndexedInstr::InferRange(RangeAnalysis* analysis, Range* range) {
   // Use the precise array element representation instead of the returned
   // representation to avoid overapproximating the range for small elements.
@@ -538,6 +538,10 @@ class RangeAnalysis : public ValueObject {
   // unconstrained definitions.
   void RemoveConstraints();
 
+  // Remove bounds checks on the induction variable from loop bodies by
+  // narrowing the loop condition (AOT only).
+  void NarrowLoopBounds();
+
   Range* ConstraintRange(Token::Kind op,
                          Definition* boundary,
                          const Range& full_range);
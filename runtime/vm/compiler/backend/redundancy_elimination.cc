@@ -27,6 +27,11 @@ DEFINE_FLAG(bool,
             trace_load_optimization,
             false,
             "Print live sets for load optimization pass.");
+DEFINE_FLAG(bool,
+            partial_load_elimination,
+            false,
+            "Eliminate loads that are redundant along some of the paths "
+            "reaching them by inserting them along the remaining paths.");
 
 // Quick access to the current zone.
 #define Z (zone())
@@ -1884,6 +1889,11 @@ class LoadOptimizer : public ValueObject {
 
     ComputeInitialSets();
     ComputeOutSets();
+    if (FLAG_partial_load_elimination && InsertPartiallyRedundantLoads()) {
+      // Inserted loads changed GEN sets of their blocks.
+      ResetInOutSets();
+      ComputeOutSets();
+    }
     ComputeOutValues();
     if (graph_->is_licm_allowed()) {
       MarkLoopInvariantLoads();
@@ -2509,6 +2519,159 @@ class LoadOptimizer : public ValueObject {
     }
   }
 
+  void ResetInOutSets() {
+    for (intptr_t i = 0; i < in_.length(); i++) {
+      in_[i]->Clear();
+      out_[i] = nullptr;
+    }
+  }
+
+  // Returns true if [load] at the beginning of its [block] would behave the
+  // same way if executed at the end of any predecessor of the [block]:
+  // its inputs are available there and nothing in front of it in the
+  // [block] guards it.
+  bool CanMoveLoadToPredecessors(Definition* load, BlockEntryInstr* block) {
+    for (intptr_t i = 0; i < load->InputCount(); i++) {
+      BlockEntryInstr* input_block = load->InputAt(i)->definition()->GetBlock();
+      if ((input_block == block) || !input_block->Dominates(block)) {
+        return false;
+      }
+    }
+    for (Instruction* instr = block->next(); instr != load;
+         instr = instr->next()) {
+      if (instr->IsCheckStackOverflow()) continue;
+      if (instr->HasUnknownSideEffects() || instr->CanDeoptimize() ||
+          instr->MayThrow()) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  // Creates a copy of [load] to be inserted on a path where its place is
+  // not available yet, or returns nullptr if the load can't be copied.
+  Definition* CopyLoad(Definition* load) {
+    if (load->representation() == kUntagged) return nullptr;
+    if (auto* load_field = load->AsLoadField()) {
+      if (load_field->calls_initializer() ||
+          load_field->slot().has_untagged_instance()) {
+        return nullptr;
+      }
+      return new (Z) LoadFieldInstr(
+          new (Z) Value(load_field->instance()->definition()),
+          load_field->slot(), load_field->source());
+    }
+    if (auto* load_indexed = load->AsLoadIndexed()) {
+      if (load_indexed->IsUntagged()) return nullptr;
+      return new (Z) LoadIndexedInstr(
+          new (Z) Value(load_indexed->array()->definition()),
+          new (Z) Value(load_indexed->index()->definition()),
+          load_indexed->RequiredInputRepresentation(
+              LoadIndexedInstr::kIndexPos) == kUnboxedIntPtr,
+          load_indexed->index_scale(), load_indexed->class_id(),
+          load_indexed->aligned() ? kAlignedAccess : kUnalignedAccess,
+          DeoptId::kNone, load_indexed->source());
+    }
+    return nullptr;
+  }
+
+  // Partial redundancy elimination for loads.
+  //
+  // An upwards exposed load in a join block which is available at the end
+  // of some (but not all) of its forward predecessors is copied to the end
+  // of the remaining predecessors. That makes it fully redundant, so that
+  // ForwardLoads() replaces it with a phi. Every predecessor of a join ends
+  // with a Goto, so no path executes more loads than before.
+  //
+  // For loop headers this forwards values stored on the back edge into the
+  // next iteration with a single load in the pre-header.
+  //
+  // Returns true if any loads were inserted.
+  bool InsertPartiallyRedundantLoads() {
+    bool inserted = false;
+    GrowableArray<BlockEntryInstr*> missing(4);
+    for (BlockIterator block_it = graph_->reverse_postorder_iterator();
+         !block_it.Done(); block_it.Advance()) {
+      BlockEntryInstr* block = block_it.Current();
+      ZoneGrowableArray<Definition*>* loads =
+          exposed_values_[block->preorder_number()];
+      if ((loads == nullptr) || !block->IsJoinEntry()) continue;
+
+      BitVector* in = in_[block->preorder_number()];
+      for (intptr_t i = 0; i < loads->length(); i++) {
+        Definition* load = (*loads)[i];
+        const intptr_t place_id = GetPlaceId(load);
+        if (in->Contains(place_id)) continue;  // Already fully redundant.
+
+        missing.Clear();
+        bool available_somewhere = false;
+        for (intptr_t j = 0; j < block->PredecessorCount(); j++) {
+          BlockEntryInstr* pred = block->PredecessorAt(j);
+          BitVector* pred_out = out_[pred->preorder_number()];
+          if (pred_out == nullptr) {
+            missing.Clear();
+            available_somewhere = false;
+            break;
+          }
+          if (pred_out->Contains(place_id)) {
+            available_somewhere = true;
+          } else {
+            missing.Add(pred);
+          }
+        }
+        if (!available_somewhere || missing.is_empty()) continue;
+
+        // Copies inserted on back edges would only move the load around the
+        // loop, and places renamed by phi moves would need translating.
+        bool can_insert = CanMoveLoadToPredecessors(load, block);
+        for (intptr_t j = 0; can_insert && (j < missing.length()); j++) {
+          BlockEntryInstr* pred = missing[j];
+          can_insert = (pred->postorder_number() > block->postorder_number()) &&
+                       pred->last_instruction()->IsGoto() &&
+                       !HasPhiMovesFor(pred, place_id);
+        }
+        Definition* copy = can_insert ? CopyLoad(load) : nullptr;
+        if (copy == nullptr) continue;
+
+        for (intptr_t j = 0; j < missing.length(); j++) {
+          BlockEntryInstr* pred = missing[j];
+          if (j > 0) copy = CopyLoad(load);
+          SetPlaceId(copy, place_id);
+          graph_->InsertBefore(pred->last_instruction(), copy, nullptr,
+                               FlowGraph::kValue);
+
+          const intptr_t pred_number = pred->preorder_number();
+          gen_[pred_number]->Add(place_id);
+          if (out_values_[pred_number] == nullptr) {
+            out_values_[pred_number] = CreateBlockOutValues();
+          }
+          (*out_values_[pred_number])[place_id] = copy;
+          inserted = true;
+
+          if (FLAG_support_il_printer && FLAG_trace_load_optimization &&
+              graph_->should_print()) {
+            THR_Print("inserted %s in B%" Pd " for partially redundant %s\n",
+                      copy->ToCString(), pred->block_id(), load->ToCString());
+          }
+        }
+      }
+    }
+    return inserted;
+  }
+
+  bool HasPhiMovesFor(BlockEntryInstr* pred, intptr_t place_id) {
+    PhiPlaceMoves::MovesList phi_moves =
+        aliased_set_->phi_moves()->GetOutgoingMoves(pred);
+    if (phi_moves == nullptr) return false;
+    for (intptr_t i = 0; i < phi_moves->length(); i++) {
+      if (((*phi_moves)[i].to() == place_id) ||
+          ((*phi_moves)[i].from() == place_id)) {
+        return true;
+      }
+    }
+    return false;
+  }
+
   // Compute out_values mappings by propagating them in reverse postorder once
   // through the graph. Generate phis on back edges where eager merge is
   // impossible.
@@ -7,6 +7,7 @@
 #include "platform/text_buffer.h"
 
 #include "vm/bit_vector.h"
+#include "vm/compiler/aot/precompiler.h"
 #include "vm/compiler/compiler_state.h"
 #include "vm/object_store.h"
 #include "vm/regexp/regexp_assembler.h"
@@ -1538,17 +1539,31 @@ CompileType StaticCallInstr::ComputeType() const {
   if (is_known_list_constructor()) {
     return ComputeListFactoryType(inferred_type, ArgumentValueAt(0));
   }
+  // What the callee's own optimized code established about its result, if
+  // it was compiled already (see Precompiler::RecordResultSummary).
+  const ResultSummary* summary = Precompiler::LookupResultSummary(function());
 
   intptr_t inferred_cid = kDynamicCid;
   bool is_nullable = CompileType::kCanBeNull;
   if (inferred_type != nullptr) {
     if (inferred_type->IsNullableInt()) {
+      if ((summary != nullptr) && !summary->is_nullable) {
+        CompileType result = inferred_type->CopyNonNullable();
+        TraceStrongModeType(this, &result);
+        return result;
+      }
       TraceStrongModeType(this, inferred_type);
       return *inferred_type;
     }
     inferred_cid = inferred_type->ToNullableCid();
     is_nullable = inferred_type->is_nullable();
   }
+  if (summary != nullptr) {
+    is_nullable = is_nullable && summary->is_nullable;
+    if (inferred_cid == kDynamicCid) {
+      inferred_cid = summary->cid;
+    }
+  }
 
   if (function_.has_pragma()) {
     const intptr_t cid = MethodRecognizer::ResultCidFromPragma(function_);
@@ -6,6 +6,7 @@
 
 #include <utility>
 
+#include "vm/compiler/aot/precompiler.h"
 #include "vm/compiler/backend/range_analysis.h"       // For Range.
 #include "vm/compiler/frontend/flow_graph_builder.h"  // For InlineExitCollector.
 #include "vm/compiler/frontend/kernel_to_il.h"        // For FlowGraphBuilder.
@@ -22,12 +23,14 @@ namespace kernel {
 #define Z (zone_)
 #define IG (thread_->isolate_group())
 
-static bool SupportsCoverage() {
-#if defined(PRODUCT)
-  return false;
-#else
-  return !CompilerState::Current().is_aot();
-#endif
+DECLARE_FLAG(bool, aot_coverage);
+
+static bool ShouldRecordCoverage(IsolateGroup* isolate_group) {
+  if (CompilerState::Current().is_aot()) {
+    return FLAG_aot_coverage;
+  }
+  // Always false in PRODUCT mode.
+  return isolate_group->coverage();
 }
 
 Fragment& Fragment::operator+=(const Fragment& other) {
@@ -1318,8 +1321,7 @@ Fragment BaseFlowGraphBuilder::RecordBranchCoverage(TokenPosition position) {
 Fragment BaseFlowGraphBuilder::RecordCoverageImpl(TokenPosition position,
                                                   bool is_branch_coverage) {
   Fragment instructions;
-  if (!SupportsCoverage()) return instructions;
-  if (!IG->coverage()) return instructions;
+  if (!ShouldRecordCoverage(IG)) return instructions;
   if (!position.IsReal()) return instructions;
   if (is_branch_coverage && !IG->branch_coverage()) return instructions;
 
@@ -1395,6 +1397,11 @@ void BaseFlowGraphBuilder::FinalizeCoverageArray() {
     value = Smi::New(0);  // no coverage recorded.
     coverage_array_.SetAt(p->value, value);
   }
+
+  if (CompilerState::Current().is_aot()) {
+    // Precompiled code has no ICData array to keep the coverage array in.
+    Precompiler::RecordCoverageArray(function_, coverage_array_);
+  }
 }
 
 }  // namespace kernel
@@ -1211,6 +1211,7 @@ class Thread : public AllStatic {
   static word unboxed_runtime_arg_offset();
 
   static word tsan_utils_offset();
+  static word safepoint_poll_page_offset();
   static word jump_to_frame_entry_point_offset();
 
   static word AllocateArray_entry_point_offset();
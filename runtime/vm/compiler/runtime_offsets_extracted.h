@@ -364,13 +364,13 @@ static constexpr dart::compiler::target::word
     Thread_call_to_runtime_entry_point_offset = 0x100;
 static constexpr dart::compiler::target::word
     Thread_call_to_runtime_stub_offset = 0x60;
-static constexpr dart::compiler::target::word Thread_dart_stream_offset = 0x3f4;
+static constexpr dart::compiler::target::word Thread_dart_stream_offset = 0x3f8;
 static constexpr dart::compiler::target::word
     Thread_dispatch_table_array_offset = 0x2c;
 static constexpr dart::compiler::target::word
     Thread_double_truncate_round_supported_offset = 0x3d4;
 static constexpr dart::compiler::target::word
-    Thread_service_extension_stream_offset = 0x3f8;
+    Thread_service_extension_stream_offset = 0x3fc;
 static constexpr dart::compiler::target::word Thread_optimize_entry_offset =
     0x128;
 static constexpr dart::compiler::target::word Thread_optimize_stub_offset =
@@ -542,6 +542,8 @@ static constexpr dart::compiler::target::word Thread_random_offset = 0x3e0;
 static constexpr dart::compiler::target::word
     Thread_jump_to_frame_entry_point_offset = 0x134;
 static constexpr dart::compiler::target::word Thread_tsan_utils_offset = 0x3e8;
+static constexpr dart::compiler::target::word
+    Thread_safepoint_poll_page_offset = 0x3ec;
 static constexpr dart::compiler::target::word TsanUtils_setjmp_function_offset =
     0x0;
 static constexpr dart::compiler::target::word TsanUtils_setjmp_buffer_offset =
@@ -1086,13 +1088,13 @@ static constexpr dart::compiler::target::word
     Thread_call_to_runtime_entry_point_offset = 0x200;
 static constexpr dart::compiler::target::word
     Thread_call_to_runtime_stub_offset = 0xc0;
-static constexpr dart::compiler::target::word Thread_dart_stream_offset = 0x7d8;
+static constexpr dart::compiler::target::word Thread_dart_stream_offset = 0x7e0;
 static constexpr dart::compiler::target::word
     Thread_dispatch_table_array_offset = 0x58;
 static constexpr dart::compiler::target::word
     Thread_double_truncate_round_supported_offset = 0x7a8;
 static constexpr dart::compiler::target::word
-    Thread_service_extension_stream_offset = 0x7e0;
+    Thread_service_extension_stream_offset = 0x7e8;
 static constexpr dart::compiler::target::word Thread_optimize_entry_offset =
     0x250;
 static constexpr dart::compiler::target::word Thread_optimize_stub_offset =
@@ -1264,6 +1266,8 @@ static constexpr dart::compiler::target::word Thread_random_offset = 0x7b8;
 static constexpr dart::compiler::target::word
     Thread_jump_to_frame_entry_point_offset = 0x268;
 static constexpr dart::compiler::target::word Thread_tsan_utils_offset = 0x7c0;
+static constexpr dart::compiler::target::word
+    Thread_safepoint_poll_page_offset = 0x7c8;
 static constexpr dart::compiler::target::word TsanUtils_setjmp_function_offset =
     0x0;
 static constexpr dart::compiler::target::word TsanUtils_setjmp_buffer_offset =
@@ -1808,13 +1812,13 @@ static constexpr dart::compiler::target::word
     Thread_call_to_runtime_entry_point_offset = 0x100;
 static constexpr dart::compiler::target::word
     Thread_call_to_runtime_stub_offset = 0x60;
-static constexpr dart::compiler::target::word Thread_dart_stream_offset = 0x3e4;
+static constexpr dart::compiler::target::word Thread_dart_stream_offset = 0x3e8;
 static constexpr dart::compiler::target::word
     Thread_dispatch_table_array_offset = 0x2c;
 static constexpr dart::compiler::target::word
     Thread_double_truncate_round_supported_offset = 0x3c4;
 static constexpr dart::compiler::target::word
-    Thread_service_extension_stream_offset = 0x3e8;
+    Thread_service_extension_stream_offset = 0x3ec;
 static constexpr dart::compiler::target::word Thread_optimize_entry_offset =
     0x128;
 static constexpr dart::compiler::target::word Thread_optimize_stub_offset =
@@ -1986,6 +1990,8 @@ static constexpr dart::compiler::target::word Thread_random_offset = 0x3d0;
 static constexpr dart::compiler::target::word
     Thread_jump_to_frame_entry_point_offset = 0x134;
 static constexpr dart::compiler::target::word Thread_tsan_utils_offset = 0x3d8;
+static constexpr dart::compiler::target::word
+    Thread_safepoint_poll_page_offset = 0x3dc;
 static constexpr dart::compiler::target::word TsanUtils_setjmp_function_offset =
     0x0;
 static constexpr dart::compiler::target::word TsanUtils_setjmp_buffer_offset =
@@ -2529,13 +2535,13 @@ static constexpr dart::compiler::target::word
     Thread_call_to_runtime_entry_point_offset = 0x200;
 static constexpr dart::compiler::target::word
     Thread_call_to_runtime_stub_offset = 0xc0;
-static constexpr dart::compiler::target::word Thread_dart_stream_offset = 0x820;
+static constexpr dart::compiler::target::word Thread_dart_stream_offset = 0x828;
 static constexpr dart::compiler::target::word
     Thread_dispatch_table_array_offset = 0x58;
 static constexpr dart::compiler::target::word
     Thread_double_truncate_round_supported_offset = 0x7f0;
 static constexpr dart::compiler::target::word
-    Thread_service_extension_stream_offset = 0x828;
+    Thread_service_extension_stream_offset = 0x830;
 static constexpr dart::compiler::target::word Thread_optimize_entry_offset =
     0x250;
 static constexpr dart::compiler::target::word Thread_optimize_stub_offset =
@@ -2707,6 +2713,8 @@ static constexpr dart::compiler::target::word Thread_random_offset = 0x800;
 static constexpr dart::compiler::target::word
     Thread_jump_to_frame_entry_point_offset = 0x268;
 static constexpr dart::compiler::target::word Thread_tsan_utils_offset = 0x808;
+static constexpr dart::compiler::target::word
+    Thread_safepoint_poll_page_offset = 0x810;
 static constexpr dart::compiler::target::word TsanUtils_setjmp_function_offset =
     0x0;
 static constexpr dart::compiler::target::word TsanUtils_setjmp_buffer_offset =
@@ -3255,13 +3263,13 @@ static constexpr dart::compiler::target::word
     Thread_call_to_runtime_entry_point_offset = 0x208;
 static constexpr dart::compiler::target::word
     Thread_call_to_runtime_stub_offset = 0xc8;
-static constexpr dart::compiler::target::word Thread_dart_stream_offset = 0x7e0;
+static constexpr dart::compiler::target::word Thread_dart_stream_offset = 0x7e8;
 static constexpr dart::compiler::target::word
     Thread_dispatch_table_array_offset = 0x60;
 static constexpr dart::compiler::target::word
     Thread_double_truncate_round_supported_offset = 0x7b0;
 static constexpr dart::compiler::target::word
-    Thread_service_extension_stream_offset = 0x7e8;
+    Thread_service_extension_stream_offset = 0x7f0;
 static constexpr dart::compiler::target::word Thread_optimize_entry_offset =
     0x258;
 static constexpr dart::compiler::target::word Thread_optimize_stub_offset =
@@ -3434,6 +3442,8 @@ static constexpr dart::compiler::target::word Thread_random_offset = 0x7c0;
 static constexpr dart::compiler::target::word
     Thread_jump_to_frame_entry_point_offset = 0x270;
 static constexpr dart::compiler::target::word Thread_tsan_utils_offset = 0x7c8;
+static constexpr dart::compiler::target::word
+    Thread_safepoint_poll_page_offset = 0x7d0;
 static constexpr dart::compiler::target::word TsanUtils_setjmp_function_offset =
     0x0;
 static constexpr dart::compiler::target::word TsanUtils_setjmp_buffer_offset =
@@ -3978,13 +3988,13 @@ static constexpr dart::compiler::target::word
     Thread_call_to_runtime_entry_point_offset = 0x208;
 static constexpr dart::compiler::target::word
     Thread_call_to_runtime_stub_offset = 0xc8;
-static constexpr dart::compiler::target::word Thread_dart_stream_offset = 0x828;
+static constexpr dart::compiler::target::word Thread_dart_stream_offset = 0x830;
 static constexpr dart::compiler::target::word
     Thread_dispatch_table_array_offset = 0x60;
 static constexpr dart::compiler::target::word
     Thread_double_truncate_round_supported_offset = 0x7f8;
 static constexpr dart::compiler::target::word
-    Thread_service_extension_stream_offset = 0x830;
+    Thread_service_extension_stream_offset = 0x838;
 static constexpr dart::compiler::target::word Thread_optimize_entry_offset =
     0x258;
 static constexpr dart::compiler::target::word Thread_optimize_stub_offset =
@@ -4157,6 +4167,8 @@ static constexpr dart::compiler::target::word Thread_random_offset = 0x808;
 static constexpr dart::compiler::target::word
     Thread_jump_to_frame_entry_point_offset = 0x270;
 static constexpr dart::compiler::target::word Thread_tsan_utils_offset = 0x810;
+static constexpr dart::compiler::target::word
+    Thread_safepoint_poll_page_offset = 0x818;
 static constexpr dart::compiler::target::word TsanUtils_setjmp_function_offset =
     0x0;
 static constexpr dart::compiler::target::word TsanUtils_setjmp_buffer_offset =
@@ -4701,13 +4713,13 @@ static constexpr dart::compiler::target::word
     Thread_call_to_runtime_entry_point_offset = 0x100;
 static constexpr dart::compiler::target::word
     Thread_call_to_runtime_stub_offset = 0x60;
-static constexpr dart::compiler::target::word Thread_dart_stream_offset = 0x41c;
+static constexpr dart::compiler::target::word Thread_dart_stream_offset = 0x420;
 static constexpr dart::compiler::target::word
     Thread_dispatch_table_array_offset = 0x2c;
 static constexpr dart::compiler::target::word
     Thread_double_truncate_round_supported_offset = 0x3fc;
 static constexpr dart::compiler::target::word
-    Thread_service_extension_stream_offset = 0x420;
+    Thread_service_extension_stream_offset = 0x424;
 static constexpr dart::compiler::target::word Thread_optimize_entry_offset =
     0x128;
 static constexpr dart::compiler::target::word Thread_optimize_stub_offset =
@@ -4879,6 +4891,8 @@ static constexpr dart::compiler::target::word Thread_random_offset = 0x408;
 static constexpr dart::compiler::target::word
     Thread_jump_to_frame_entry_point_offset = 0x134;
 static constexpr dart::compiler::target::word Thread_tsan_utils_offset = 0x410;
+static constexpr dart::compiler::target::word
+    Thread_safepoint_poll_page_offset = 0x414;
 static constexpr dart::compiler::target::word TsanUtils_setjmp_function_offset =
     0x0;
 static constexpr dart::compiler::target::word TsanUtils_setjmp_buffer_offset =
@@ -5424,13 +5438,13 @@ static constexpr dart::compiler::target::word
     Thread_call_to_runtime_entry_point_offset = 0x200;
 static constexpr dart::compiler::target::word
     Thread_call_to_runtime_stub_offset = 0xc0;
-static constexpr dart::compiler::target::word Thread_dart_stream_offset = 0x810;
+static constexpr dart::compiler::target::word Thread_dart_stream_offset = 0x818;
 static constexpr dart::compiler::target::word
     Thread_dispatch_table_array_offset = 0x58;
 static constexpr dart::compiler::target::word
     Thread_double_truncate_round_supported_offset = 0x7e0;
 static constexpr dart::compiler::target::word
-    Thread_service_extension_stream_offset = 0x818;
+    Thread_service_extension_stream_offset = 0x820;
 static constexpr dart::compiler::target::word Thread_optimize_entry_offset =
     0x250;
 static constexpr dart::compiler::target::word Thread_optimize_stub_offset =
@@ -5602,6 +5616,8 @@ static constexpr dart::compiler::target::word Thread_random_offset = 0x7f0;
 static constexpr dart::compiler::target::word
     Thread_jump_to_frame_entry_point_offset = 0x268;
 static constexpr dart::compiler::target::word Thread_tsan_utils_offset = 0x7f8;
+static constexpr dart::compiler::target::word
+    Thread_safepoint_poll_page_offset = 0x800;
 static constexpr dart::compiler::target::word TsanUtils_setjmp_function_offset =
     0x0;
 static constexpr dart::compiler::target::word TsanUtils_setjmp_buffer_offset =
@@ -6139,13 +6155,13 @@ static constexpr dart::compiler::target::word
     Thread_call_to_runtime_entry_point_offset = 0x100;
 static constexpr dart::compiler::target::word
     Thread_call_to_runtime_stub_offset = 0x60;
-static constexpr dart::compiler::target::word Thread_dart_stream_offset = 0x3f4;
+static constexpr dart::compiler::target::word Thread_dart_stream_offset = 0x3f8;
 static constexpr dart::compiler::target::word
     Thread_dispatch_table_array_offset = 0x2c;
 static constexpr dart::compiler::target::word
     Thread_double_truncate_round_supported_offset = 0x3d4;
 static constexpr dart::compiler::target::word
-    Thread_service_extension_stream_offset = 0x3f8;
+    Thread_service_extension_stream_offset = 0x3fc;
 static constexpr dart::compiler::target::word Thread_optimize_entry_offset =
     0x128;
 static constexpr dart::compiler::target::word Thread_optimize_stub_offset =
@@ -6317,6 +6333,8 @@ static constexpr dart::compiler::target::word Thread_random_offset = 0x3e0;
 static constexpr dart::compiler::target::word
     Thread_jump_to_frame_entry_point_offset = 0x134;
 static constexpr dart::compiler::target::word Thread_tsan_utils_offset = 0x3e8;
+static constexpr dart::compiler::target::word
+    Thread_safepoint_poll_page_offset = 0x3ec;
 static constexpr dart::compiler::target::word TsanUtils_setjmp_function_offset =
     0x0;
 static constexpr dart::compiler::target::word TsanUtils_setjmp_buffer_offset =
@@ -6853,13 +6871,13 @@ static constexpr dart::compiler::target::word
     Thread_call_to_runtime_entry_point_offset = 0x200;
 static constexpr dart::compiler::target::word
     Thread_call_to_runtime_stub_offset = 0xc0;
-static constexpr dart::compiler::target::word Thread_dart_stream_offset = 0x7d8;
+static constexpr dart::compiler::target::word Thread_dart_stream_offset = 0x7e0;
 static constexpr dart::compiler::target::word
     Thread_dispatch_table_array_offset = 0x58;
 static constexpr dart::compiler::target::word
     Thread_double_truncate_round_supported_offset = 0x7a8;
 static constexpr dart::compiler::target::word
-    Thread_service_extension_stream_offset = 0x7e0;
+    Thread_service_extension_stream_offset = 0x7e8;
 static constexpr dart::compiler::target::word Thread_optimize_entry_offset =
     0x250;
 static constexpr dart::compiler::target::word Thread_optimize_stub_offset =
@@ -7031,6 +7049,8 @@ static constexpr dart::compiler::target::word Thread_random_offset = 0x7b8;
 static constexpr dart::compiler::target::word
     Thread_jump_to_frame_entry_point_offset = 0x268;
 static constexpr dart::compiler::target::word Thread_tsan_utils_offset = 0x7c0;
+static constexpr dart::compiler::target::word
+    Thread_safepoint_poll_page_offset = 0x7c8;
 static constexpr dart::compiler::target::word TsanUtils_setjmp_function_offset =
     0x0;
 static constexpr dart::compiler::target::word TsanUtils_setjmp_buffer_offset =
@@ -7567,13 +7587,13 @@ static constexpr dart::compiler::target::word
     Thread_call_to_runtime_entry_point_offset = 0x100;
 static constexpr dart::compiler::target::word
     Thread_call_to_runtime_stub_offset = 0x60;
-static constexpr dart::compiler::target::word Thread_dart_stream_offset = 0x3e4;
+static constexpr dart::compiler::target::word Thread_dart_stream_offset = 0x3e8;
 static constexpr dart::compiler::target::word
     Thread_dispatch_table_array_offset = 0x2c;
 static constexpr dart::compiler::target::word
     Thread_double_truncate_round_supported_offset = 0x3c4;
 static constexpr dart::compiler::target::word
-    Thread_service_extension_stream_offset = 0x3e8;
+    Thread_service_extension_stream_offset = 0x3ec;
 static constexpr dart::compiler::target::word Thread_optimize_entry_offset =
     0x128;
 static constexpr dart::compiler::target::word Thread_optimize_stub_offset =
@@ -7745,6 +7765,8 @@ static constexpr dart::compiler::target::word Thread_random_offset = 0x3d0;
 static constexpr dart::compiler::target::word
     Thread_jump_to_frame_entry_point_offset = 0x134;
 static constexpr dart::compiler::target::word Thread_tsan_utils_offset = 0x3d8;
+static constexpr dart::compiler::target::word
+    Thread_safepoint_poll_page_offset = 0x3dc;
 static constexpr dart::compiler::target::word TsanUtils_setjmp_function_offset =
     0x0;
 static constexpr dart::compiler::target::word TsanUtils_setjmp_buffer_offset =
@@ -8280,13 +8302,13 @@ static constexpr dart::compiler::target::word
     Thread_call_to_runtime_entry_point_offset = 0x200;
 static constexpr dart::compiler::target::word
     Thread_call_to_runtime_stub_offset = 0xc0;
-static constexpr dart::compiler::target::word Thread_dart_stream_offset = 0x820;
+static constexpr dart::compiler::target::word Thread_dart_stream_offset = 0x828;
 static constexpr dart::compiler::target::word
     Thread_dispatch_table_array_offset = 0x58;
 static constexpr dart::compiler::target::word
     Thread_double_truncate_round_supported_offset = 0x7f0;
 static constexpr dart::compiler::target::word
-    Thread_service_extension_stream_offset = 0x828;
+    Thread_service_extension_stream_offset = 0x830;
 static constexpr dart::compiler::target::word Thread_optimize_entry_offset =
     0x250;
 static constexpr dart::compiler::target::word Thread_optimize_stub_offset =
@@ -8458,6 +8480,8 @@ static constexpr dart::compiler::target::word Thread_random_offset = 0x800;
 static constexpr dart::compiler::target::word
     Thread_jump_to_frame_entry_point_offset = 0x268;
 static constexpr dart::compiler::target::word Thread_tsan_utils_offset = 0x808;
+static constexpr dart::compiler::target::word
+    Thread_safepoint_poll_page_offset = 0x810;
 static constexpr dart::compiler::target::word TsanUtils_setjmp_function_offset =
     0x0;
 static constexpr dart::compiler::target::word TsanUtils_setjmp_buffer_offset =
@@ -8998,13 +9022,13 @@ static constexpr dart::compiler::target::word
     Thread_call_to_runtime_entry_point_offset = 0x208;
 static constexpr dart::compiler::target::word
     Thread_call_to_runtime_stub_offset = 0xc8;
-static constexpr dart::compiler::target::word Thread_dart_stream_offset = 0x7e0;
+static constexpr dart::compiler::target::word Thread_dart_stream_offset = 0x7e8;
 static constexpr dart::compiler::target::word
     Thread_dispatch_table_array_offset = 0x60;
 static constexpr dart::compiler::target::word
     Thread_double_truncate_round_supported_offset = 0x7b0;
 static constexpr dart::compiler::target::word
-    Thread_service_extension_stream_offset = 0x7e8;
+    Thread_service_extension_stream_offset = 0x7f0;
 static constexpr dart::compiler::target::word Thread_optimize_entry_offset =
     0x258;
 static constexpr dart::compiler::target::word Thread_optimize_stub_offset =
@@ -9177,6 +9201,8 @@ static constexpr dart::compiler::target::word Thread_random_offset = 0x7c0;
 static constexpr dart::compiler::target::word
     Thread_jump_to_frame_entry_point_offset = 0x270;
 static constexpr dart::compiler::target::word Thread_tsan_utils_offset = 0x7c8;
+static constexpr dart::compiler::target::word
+    Thread_safepoint_poll_page_offset = 0x7d0;
 static constexpr dart::compiler::target::word TsanUtils_setjmp_function_offset =
     0x0;
 static constexpr dart::compiler::target::word TsanUtils_setjmp_buffer_offset =
@@ -9713,13 +9739,13 @@ static constexpr dart::compiler::target::word
     Thread_call_to_runtime_entry_point_offset = 0x208;
 static constexpr dart::compiler::target::word
     Thread_call_to_runtime_stub_offset = 0xc8;
-static constexpr dart::compiler::target::word Thread_dart_stream_offset = 0x828;
+static constexpr dart::compiler::target::word Thread_dart_stream_offset = 0x830;
 static constexpr dart::compiler::target::word
     Thread_dispatch_table_array_offset = 0x60;
 static constexpr dart::compiler::target::word
     Thread_double_truncate_round_supported_offset = 0x7f8;
 static constexpr dart::compiler::target::word
-    Thread_service_extension_stream_offset = 0x830;
+    Thread_service_extension_stream_offset = 0x838;
 static constexpr dart::compiler::target::word Thread_optimize_entry_offset =
     0x258;
 static constexpr dart::compiler::target::word Thread_optimize_stub_offset =
@@ -9892,6 +9918,8 @@ static constexpr dart::compiler::target::word Thread_random_offset = 0x808;
 static constexpr dart::compiler::target::word
     Thread_jump_to_frame_entry_point_offset = 0x270;
 static constexpr dart::compiler::target::word Thread_tsan_utils_offset = 0x810;
+static constexpr dart::compiler::target::word
+    Thread_safepoint_poll_page_offset = 0x818;
 static constexpr dart::compiler::target::word TsanUtils_setjmp_function_offset =
     0x0;
 static constexpr dart::compiler::target::word TsanUtils_setjmp_buffer_offset =
@@ -10428,13 +10456,13 @@ static constexpr dart::compiler::target::word
     Thread_call_to_runtime_entry_point_offset = 0x100;
 static constexpr dart::compiler::target::word
     Thread_call_to_runtime_stub_offset = 0x60;
-static constexpr dart::compiler::target::word Thread_dart_stream_offset = 0x41c;
+static constexpr dart::compiler::target::word Thread_dart_stream_offset = 0x420;
 static constexpr dart::compiler::target::word
     Thread_dispatch_table_array_offset = 0x2c;
 static constexpr dart::compiler::target::word
     Thread_double_truncate_round_supported_offset = 0x3fc;
 static constexpr dart::compiler::target::word
-    Thread_service_extension_stream_offset = 0x420;
+    Thread_service_extension_stream_offset = 0x424;
 static constexpr dart::compiler::target::word Thread_optimize_entry_offset =
     0x128;
 static constexpr dart::compiler::target::word Thread_optimize_stub_offset =
@@ -10606,6 +10634,8 @@ static constexpr dart::compiler::target::word Thread_random_offset = 0x408;
 static constexpr dart::compiler::target::word
     Thread_jump_to_frame_entry_point_offset = 0x134;
 static constexpr dart::compiler::target::word Thread_tsan_utils_offset = 0x410;
+static constexpr dart::compiler::target::word
+    Thread_safepoint_poll_page_offset = 0x414;
 static constexpr dart::compiler::target::word TsanUtils_setjmp_function_offset =
     0x0;
 static constexpr dart::compiler::target::word TsanUtils_setjmp_buffer_offset =
@@ -11143,13 +11173,13 @@ static constexpr dart::compiler::target::word
     Thread_call_to_runtime_entry_point_offset = 0x200;
 static constexpr dart::compiler::target::word
     Thread_call_to_runtime_stub_offset = 0xc0;
-static constexpr dart::compiler::target::word Thread_dart_stream_offset = 0x810;
+static constexpr dart::compiler::target::word Thread_dart_stream_offset = 0x818;
 static constexpr dart::compiler::target::word
     Thread_dispatch_table_array_offset = 0x58;
 static constexpr dart::compiler::target::word
     Thread_double_truncate_round_supported_offset = 0x7e0;
 static constexpr dart::compiler::target::word
-    Thread_service_extension_stream_offset = 0x818;
+    Thread_service_extension_stream_offset = 0x820;
 static constexpr dart::compiler::target::word Thread_optimize_entry_offset =
     0x250;
 static constexpr dart::compiler::target::word Thread_optimize_stub_offset =
@@ -11321,6 +11351,8 @@ static constexpr dart::compiler::target::word Thread_random_offset = 0x7f0;
 static constexpr dart::compiler::target::word
     Thread_jump_to_frame_entry_point_offset = 0x268;
 static constexpr dart::compiler::target::word Thread_tsan_utils_offset = 0x7f8;
+static constexpr dart::compiler::target::word
+    Thread_safepoint_poll_page_offset = 0x800;
 static constexpr dart::compiler::target::word TsanUtils_setjmp_function_offset =
     0x0;
 static constexpr dart::compiler::target::word TsanUtils_setjmp_buffer_offset =
@@ -11900,13 +11932,13 @@ static constexpr dart::compiler::target::word
 static constexpr dart::compiler::target::word
     AOT_Thread_call_to_runtime_stub_offset = 0x60;
 static constexpr dart::compiler::target::word AOT_Thread_dart_stream_offset =
-    0x3f4;
+    0x3f8;
 static constexpr dart::compiler::target::word
     AOT_Thread_dispatch_table_array_offset = 0x2c;
 static constexpr dart::compiler::target::word
     AOT_Thread_double_truncate_round_supported_offset = 0x3d4;
 static constexpr dart::compiler::target::word
-    AOT_Thread_service_extension_stream_offset = 0x3f8;
+    AOT_Thread_service_extension_stream_offset = 0x3fc;
 static constexpr dart::compiler::target::word AOT_Thread_optimize_entry_offset =
     0x128;
 static constexpr dart::compiler::target::word AOT_Thread_optimize_stub_offset =
@@ -12088,6 +12120,8 @@ static constexpr dart::compiler::target::word
     AOT_Thread_jump_to_frame_entry_point_offset = 0x134;
 static constexpr dart::compiler::target::word AOT_Thread_tsan_utils_offset =
     0x3e8;
+static constexpr dart::compiler::target::word
+    AOT_Thread_safepoint_poll_page_offset = 0x3ec;
 static constexpr dart::compiler::target::word
     AOT_TsanUtils_setjmp_function_offset = 0x0;
 static constexpr dart::compiler::target::word
@@ -12700,13 +12734,13 @@ static constexpr dart::compiler::target::word
 static constexpr dart::compiler::target::word
     AOT_Thread_call_to_runtime_stub_offset = 0xc0;
 static constexpr dart::compiler::target::word AOT_Thread_dart_stream_offset =
-    0x7d8;
+    0x7e0;
 static constexpr dart::compiler::target::word
     AOT_Thread_dispatch_table_array_offset = 0x58;
 static constexpr dart::compiler::target::word
     AOT_Thread_double_truncate_round_supported_offset = 0x7a8;
 static constexpr dart::compiler::target::word
-    AOT_Thread_service_extension_stream_offset = 0x7e0;
+    AOT_Thread_service_extension_stream_offset = 0x7e8;
 static constexpr dart::compiler::target::word AOT_Thread_optimize_entry_offset =
     0x250;
 static constexpr dart::compiler::target::word AOT_Thread_optimize_stub_offset =
@@ -12888,6 +12922,8 @@ static constexpr dart::compiler::target::word
     AOT_Thread_jump_to_frame_entry_point_offset = 0x268;
 static constexpr dart::compiler::target::word AOT_Thread_tsan_utils_offset =
     0x7c0;
+static constexpr dart::compiler::target::word
+    AOT_Thread_safepoint_poll_page_offset = 0x7c8;
 static constexpr dart::compiler::target::word
     AOT_TsanUtils_setjmp_function_offset = 0x0;
 static constexpr dart::compiler::target::word
@@ -13507,13 +13543,13 @@ static constexpr dart::compiler::target::word
 static constexpr dart::compiler::target::word
     AOT_Thread_call_to_runtime_stub_offset = 0xc0;
 static constexpr dart::compiler::target::word AOT_Thread_dart_stream_offset =
-    0x820;
+    0x828;
 static constexpr dart::compiler::target::word
     AOT_Thread_dispatch_table_array_offset = 0x58;
 static constexpr dart::compiler::target::word
     AOT_Thread_double_truncate_round_supported_offset = 0x7f0;
 static constexpr dart::compiler::target::word
-    AOT_Thread_service_extension_stream_offset = 0x828;
+    AOT_Thread_service_extension_stream_offset = 0x830;
 static constexpr dart::compiler::target::word AOT_Thread_optimize_entry_offset =
     0x250;
 static constexpr dart::compiler::target::word AOT_Thread_optimize_stub_offset =
@@ -13695,6 +13731,8 @@ static constexpr dart::compiler::target::word
     AOT_Thread_jump_to_frame_entry_point_offset = 0x268;
 static constexpr dart::compiler::target::word AOT_Thread_tsan_utils_offset =
     0x808;
+static constexpr dart::compiler::target::word
+    AOT_Thread_safepoint_poll_page_offset = 0x810;
 static constexpr dart::compiler::target::word
     AOT_TsanUtils_setjmp_function_offset = 0x0;
 static constexpr dart::compiler::target::word
@@ -14310,13 +14348,13 @@ static constexpr dart::compiler::target::word
 static constexpr dart::compiler::target::word
     AOT_Thread_call_to_runtime_stub_offset = 0xc8;
 static constexpr dart::compiler::target::word AOT_Thread_dart_stream_offset =
-    0x7e0;
+    0x7e8;
 static constexpr dart::compiler::target::word
     AOT_Thread_dispatch_table_array_offset = 0x60;
 static constexpr dart::compiler::target::word
     AOT_Thread_double_truncate_round_supported_offset = 0x7b0;
 static constexpr dart::compiler::target::word
-    AOT_Thread_service_extension_stream_offset = 0x7e8;
+    AOT_Thread_service_extension_stream_offset = 0x7f0;
 static constexpr dart::compiler::target::word AOT_Thread_optimize_entry_offset =
     0x258;
 static constexpr dart::compiler::target::word AOT_Thread_optimize_stub_offset =
@@ -14500,6 +14538,8 @@ static constexpr dart::compiler::target::word
     AOT_Thread_jump_to_frame_entry_point_offset = 0x270;
 static constexpr dart::compiler::target::word AOT_Thread_tsan_utils_offset =
     0x7c8;
+static constexpr dart::compiler::target::word
+    AOT_Thread_safepoint_poll_page_offset = 0x7d0;
 static constexpr dart::compiler::target::word
     AOT_TsanUtils_setjmp_function_offset = 0x0;
 static constexpr dart::compiler::target::word
@@ -15113,13 +15153,13 @@ static constexpr dart::compiler::target::word
 static constexpr dart::compiler::target::word
     AOT_Thread_call_to_runtime_stub_offset = 0xc8;
 static constexpr dart::compiler::target::word AOT_Thread_dart_stream_offset =
-    0x828;
+    0x830;
 static constexpr dart::compiler::target::word
     AOT_Thread_dispatch_table_array_offset = 0x60;
 static constexpr dart::compiler::target::word
     AOT_Thread_double_truncate_round_supported_offset = 0x7f8;
 static constexpr dart::compiler::target::word
-    AOT_Thread_service_extension_stream_offset = 0x830;
+    AOT_Thread_service_extension_stream_offset = 0x838;
 static constexpr dart::compiler::target::word AOT_Thread_optimize_entry_offset =
     0x258;
 static constexpr dart::compiler::target::word AOT_Thread_optimize_stub_offset =
@@ -15303,6 +15343,8 @@ static constexpr dart::compiler::target::word
     AOT_Thread_jump_to_frame_entry_point_offset = 0x270;
 static constexpr dart::compiler::target::word AOT_Thread_tsan_utils_offset =
     0x810;
+static constexpr dart::compiler::target::word
+    AOT_Thread_safepoint_poll_page_offset = 0x818;
 static constexpr dart::compiler::target::word
     AOT_TsanUtils_setjmp_function_offset = 0x0;
 static constexpr dart::compiler::target::word
@@ -15917,13 +15959,13 @@ static constexpr dart::compiler::target::word
 static constexpr dart::compiler::target::word
     AOT_Thread_call_to_runtime_stub_offset = 0x60;
 static constexpr dart::compiler::target::word AOT_Thread_dart_stream_offset =
-    0x41c;
+    0x420;
 static constexpr dart::compiler::target::word
     AOT_Thread_dispatch_table_array_offset = 0x2c;
 static constexpr dart::compiler::target::word
     AOT_Thread_double_truncate_round_supported_offset = 0x3fc;
 static constexpr dart::compiler::target::word
-    AOT_Thread_service_extension_stream_offset = 0x420;
+    AOT_Thread_service_extension_stream_offset = 0x424;
 static constexpr dart::compiler::target::word AOT_Thread_optimize_entry_offset =
     0x128;
 static constexpr dart::compiler::target::word AOT_Thread_optimize_stub_offset =
@@ -16105,6 +16147,8 @@ static constexpr dart::compiler::target::word
     AOT_Thread_jump_to_frame_entry_point_offset = 0x134;
 static constexpr dart::compiler::target::word AOT_Thread_tsan_utils_offset =
     0x410;
+static constexpr dart::compiler::target::word
+    AOT_Thread_safepoint_poll_page_offset = 0x414;
 static constexpr dart::compiler::target::word
     AOT_TsanUtils_setjmp_function_offset = 0x0;
 static constexpr dart::compiler::target::word
@@ -16718,13 +16762,13 @@ static constexpr dart::compiler::target::word
 static constexpr dart::compiler::target::word
     AOT_Thread_call_to_runtime_stub_offset = 0xc0;
 static constexpr dart::compiler::target::word AOT_Thread_dart_stream_offset =
-    0x810;
+    0x818;
 static constexpr dart::compiler::target::word
     AOT_Thread_dispatch_table_array_offset = 0x58;
 static constexpr dart::compiler::target::word
     AOT_Thread_double_truncate_round_supported_offset = 0x7e0;
 static constexpr dart::compiler::target::word
-    AOT_Thread_service_extension_stream_offset = 0x818;
+    AOT_Thread_service_extension_stream_offset = 0x820;
 static constexpr dart::compiler::target::word AOT_Thread_optimize_entry_offset =
     0x250;
 static constexpr dart::compiler::target::word AOT_Thread_optimize_stub_offset =
@@ -16906,6 +16950,8 @@ static constexpr dart::compiler::target::word
     AOT_Thread_jump_to_frame_entry_point_offset = 0x268;
 static constexpr dart::compiler::target::word AOT_Thread_tsan_utils_offset =
     0x7f8;
+static constexpr dart::compiler::target::word
+    AOT_Thread_safepoint_poll_page_offset = 0x800;
 static constexpr dart::compiler::target::word
     AOT_TsanUtils_setjmp_function_offset = 0x0;
 static constexpr dart::compiler::target::word
@@ -17510,13 +17556,13 @@ static constexpr dart::compiler::target::word
 static constexpr dart::compiler::target::word
     AOT_Thread_call_to_runtime_stub_offset = 0x60;
 static constexpr dart::compiler::target::word AOT_Thread_dart_stream_offset =
-    0x3f4;
+    0x3f8;
 static constexpr dart::compiler::target::word
     AOT_Thread_dispatch_table_array_offset = 0x2c;
 static constexpr dart::compiler::target::word
     AOT_Thread_double_truncate_round_supported_offset = 0x3d4;
 static constexpr dart::compiler::target::word
-    AOT_Thread_service_extension_stream_offset = 0x3f8;
+    AOT_Thread_service_extension_stream_offset = 0x3fc;
 static constexpr dart::compiler::target::word AOT_Thread_optimize_entry_offset =
     0x128;
 static constexpr dart::compiler::target::word AOT_Thread_optimize_stub_offset =
@@ -17698,6 +17744,8 @@ static constexpr dart::compiler::target::word
     AOT_Thread_jump_to_frame_entry_point_offset = 0x134;
 static constexpr dart::compiler::target::word AOT_Thread_tsan_utils_offset =
     0x3e8;
+static constexpr dart::compiler::target::word
+    AOT_Thread_safepoint_poll_page_offset = 0x3ec;
 static constexpr dart::compiler::target::word
     AOT_TsanUtils_setjmp_function_offset = 0x0;
 static constexpr dart::compiler::target::word
@@ -18301,13 +18349,13 @@ static constexpr dart::compiler::target::word
 static constexpr dart::compiler::target::word
     AOT_Thread_call_to_runtime_stub_offset = 0xc0;
 static constexpr dart::compiler::target::word AOT_Thread_dart_stream_offset =
-    0x7d8;
+    0x7e0;
 static constexpr dart::compiler::target::word
     AOT_Thread_dispatch_table_array_offset = 0x58;
 static constexpr dart::compiler::target::word
     AOT_Thread_double_truncate_round_supported_offset = 0x7a8;
 static constexpr dart::compiler::target::word
-    AOT_Thread_service_extension_stream_offset = 0x7e0;
+    AOT_Thread_service_extension_stream_offset = 0x7e8;
 static constexpr dart::compiler::target::word AOT_Thread_optimize_entry_offset =
     0x250;
 static constexpr dart::compiler::target::word AOT_Thread_optimize_stub_offset =
@@ -18489,6 +18537,8 @@ static constexpr dart::compiler::target::word
     AOT_Thread_jump_to_frame_entry_point_offset = 0x268;
 static constexpr dart::compiler::target::word AOT_Thread_tsan_utils_offset =
     0x7c0;
+static constexpr dart::compiler::target::word
+    AOT_Thread_safepoint_poll_page_offset = 0x7c8;
 static constexpr dart::compiler::target::word
     AOT_TsanUtils_setjmp_function_offset = 0x0;
 static constexpr dart::compiler::target::word
@@ -19099,13 +19149,13 @@ static constexpr dart::compiler::target::word
 static constexpr dart::compiler::target::word
     AOT_Thread_call_to_runtime_stub_offset = 0xc0;
 static constexpr dart::compiler::target::word AOT_Thread_dart_stream_offset =
-    0x820;
+    0x828;
 static constexpr dart::compiler::target::word
     AOT_Thread_dispatch_table_array_offset = 0x58;
 static constexpr dart::compiler::target::word
     AOT_Thread_double_truncate_round_supported_offset = 0x7f0;
 static constexpr dart::compiler::target::word
-    AOT_Thread_service_extension_stream_offset = 0x828;
+    AOT_Thread_service_extension_stream_offset = 0x830;
 static constexpr dart::compiler::target::word AOT_Thread_optimize_entry_offset =
     0x250;
 static constexpr dart::compiler::target::word AOT_Thread_optimize_stub_offset =
@@ -19287,6 +19337,8 @@ static constexpr dart::compiler::target::word
     AOT_Thread_jump_to_frame_entry_point_offset = 0x268;
 static constexpr dart::compiler::target::word AOT_Thread_tsan_utils_offset =
     0x808;
+static constexpr dart::compiler::target::word
+    AOT_Thread_safepoint_poll_page_offset = 0x810;
 static constexpr dart::compiler::target::word
     AOT_TsanUtils_setjmp_function_offset = 0x0;
 static constexpr dart::compiler::target::word
@@ -19893,13 +19945,13 @@ static constexpr dart::compiler::target::word
 static constexpr dart::compiler::target::word
     AOT_Thread_call_to_runtime_stub_offset = 0xc8;
 static constexpr dart::compiler::target::word AOT_Thread_dart_stream_offset =
-    0x7e0;
+    0x7e8;
 static constexpr dart::compiler::target::word
     AOT_Thread_dispatch_table_array_offset = 0x60;
 static constexpr dart::compiler::target::word
     AOT_Thread_double_truncate_round_supported_offset = 0x7b0;
 static constexpr dart::compiler::target::word
-    AOT_Thread_service_extension_stream_offset = 0x7e8;
+    AOT_Thread_service_extension_stream_offset = 0x7f0;
 static constexpr dart::compiler::target::word AOT_Thread_optimize_entry_offset =
     0x258;
 static constexpr dart::compiler::target::word AOT_Thread_optimize_stub_offset =
@@ -20083,6 +20135,8 @@ static constexpr dart::compiler::target::word
     AOT_Thread_jump_to_frame_entry_point_offset = 0x270;
 static constexpr dart::compiler::target::word AOT_Thread_tsan_utils_offset =
     0x7c8;
+static constexpr dart::compiler::target::word
+    AOT_Thread_safepoint_poll_page_offset = 0x7d0;
 static constexpr dart::compiler::target::word
     AOT_TsanUtils_setjmp_function_offset = 0x0;
 static constexpr dart::compiler::target::word
@@ -20687,13 +20741,13 @@ static constexpr dart::compiler::target::word
 static constexpr dart::compiler::target::word
     AOT_Thread_call_to_runtime_stub_offset = 0xc8;
 static constexpr dart::compiler::target::word AOT_Thread_dart_stream_offset =
-    0x828;
+    0x830;
 static constexpr dart::compiler::target::word
     AOT_Thread_dispatch_table_array_offset = 0x60;
 static constexpr dart::compiler::target::word
     AOT_Thread_double_truncate_round_supported_offset = 0x7f8;
 static constexpr dart::compiler::target::word
-    AOT_Thread_service_extension_stream_offset = 0x830;
+    AOT_Thread_service_extension_stream_offset = 0x838;
 static constexpr dart::compiler::target::word AOT_Thread_optimize_entry_offset =
     0x258;
 static constexpr dart::compiler::target::word AOT_Thread_optimize_stub_offset =
@@ -20877,6 +20931,8 @@ static constexpr dart::compiler::target::word
     AOT_Thread_jump_to_frame_entry_point_offset = 0x270;
 static constexpr dart::compiler::target::word AOT_Thread_tsan_utils_offset =
     0x810;
+static constexpr dart::compiler::target::word
+    AOT_Thread_safepoint_poll_page_offset = 0x818;
 static constexpr dart::compiler::target::word
     AOT_TsanUtils_setjmp_function_offset = 0x0;
 static constexpr dart::compiler::target::word
@@ -21482,13 +21538,13 @@ static constexpr dart::compiler::target::word
 static constexpr dart::compiler::target::word
     AOT_Thread_call_to_runtime_stub_offset = 0x60;
 static constexpr dart::compiler::target::word AOT_Thread_dart_stream_offset =
-    0x41c;
+    0x420;
 static constexpr dart::compiler::target::word
     AOT_Thread_dispatch_table_array_offset = 0x2c;
 static constexpr dart::compiler::target::word
     AOT_Thread_double_truncate_round_supported_offset = 0x3fc;
 static constexpr dart::compiler::target::word
-    AOT_Thread_service_extension_stream_offset = 0x420;
+    AOT_Thread_service_extension_stream_offset = 0x424;
 static constexpr dart::compiler::target::word AOT_Thread_optimize_entry_offset =
     0x128;
 static constexpr dart::compiler::target::word AOT_Thread_optimize_stub_offset =
@@ -21670,6 +21726,8 @@ static constexpr dart::compiler::target::word
     AOT_Thread_jump_to_frame_entry_point_offset = 0x134;
 static constexpr dart::compiler::target::word AOT_Thread_tsan_utils_offset =
     0x410;
+static constexpr dart::compiler::target::word
+    AOT_Thread_safepoint_poll_page_offset = 0x414;
 static constexpr dart::compiler::target::word
     AOT_TsanUtils_setjmp_function_offset = 0x0;
 static constexpr dart::compiler::target::word
@@ -22274,13 +22332,13 @@ static constexpr dart::compiler::target::word
 static constexpr dart::compiler::target::word
     AOT_Thread_call_to_runtime_stub_offset = 0xc0;
 static constexpr dart::compiler::target::word AOT_Thread_dart_stream_offset =
-    0x810;
+    0x818;
 static constexpr dart::compiler::target::word
     AOT_Thread_dispatch_table_array_offset = 0x58;
 static constexpr dart::compiler::target::word
     AOT_Thread_double_truncate_round_supported_offset = 0x7e0;
 static constexpr dart::compiler::target::word
-    AOT_Thread_service_extension_stream_offset = 0x818;
+    AOT_Thread_service_extension_stream_offset = 0x820;
 static constexpr dart::compiler::target::word AOT_Thread_optimize_entry_offset =
     0x250;
 static constexpr dart::compiler::target::word AOT_Thread_optimize_stub_offset =
@@ -22462,6 +22520,8 @@ static constexpr dart::compiler::target::word
     AOT_Thread_jump_to_frame_entry_point_offset = 0x268;
 static constexpr dart::compiler::target::word AOT_Thread_tsan_utils_offset =
     0x7f8;
+static constexpr dart::compiler::target::word
+    AOT_Thread_safepoint_poll_page_offset = 0x800;
 static constexpr dart::compiler::target::word
     AOT_TsanUtils_setjmp_function_offset = 0x0;
 static constexpr dart::compiler::target::word
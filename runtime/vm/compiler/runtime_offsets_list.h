@@ -353,6 +353,7 @@
   FIELD(Thread, random_offset)                                                 \
   FIELD(Thread, jump_to_frame_entry_point_offset)                              \
   FIELD(Thread, tsan_utils_offset)                                             \
+  FIELD(Thread, safepoint_poll_page_offset)                                    \
   FIELD(TsanUtils, setjmp_function_offset)                                     \
   FIELD(TsanUtils, setjmp_buffer_offset)                                       \
   FIELD(TsanUtils, exception_pc_offset)                                        \
@@ -3,11 +3,18 @@
 // BSD-style license that can be found in the LICENSE file.
 
 #include "vm/compiler/write_barrier_elimination.h"
+#include "vm/compiler/aot/precompiler.h"
 #include "vm/compiler/backend/flow_graph.h"
 #include "vm/compiler/compiler_pass.h"
 
 namespace dart {
 
+DEFINE_FLAG(bool,
+            write_barrier_elimination_across_calls,
+            false,
+            "Keep eliminating write barriers across static calls to functions "
+            "whose code can neither call Dart code nor trigger GC.");
+
 #if defined(DEBUG)
 DEFINE_FLAG(bool,
             trace_write_barrier_elimination,
@@ -68,6 +75,12 @@ typedef DirectChainedHashMap<DefinitionIndexPairTrait> DefinitionIndexMap;
 // buffer. Additionally, if concurrent marking was initiated, the runtime
 // ensures that all live temporaries are also in the deferred marking stack.
 //
+// Calls clear the vector: a scavenge in the callee only restores the invariant
+// for the callee's frame. With --write-barrier-elimination-across-calls, the
+// precompiler records functions whose code can neither call Dart code nor
+// trigger GC (see Precompiler::RecordGCFreeFunction), and calls to them keep
+// the vector.
+//
 // See also Thread::RememberLiveTemporaries() and
 // Thread::DeferredMarkLiveTemporaries().
 class WriteBarrierElimination : public ValueObject {
@@ -387,6 +400,21 @@ bool WriteBarrierElimination::SlotEligibleForWBE(const Slot& slot) {
 }
 #endif
 
+// Whether [instr] is a static call to an already compiled function whose
+// code can neither call Dart code nor trigger GC. If that code may throw,
+// the call must also be outside of any try block: throwing may trigger GC
+// without restoring the invariant for the caller's frame, which is harmless
+// only if the caller's frame is unwound too.
+static bool IsGCFreeCall(Instruction* instr) {
+  StaticCallInstr* call = instr->AsStaticCall();
+  if (call == nullptr) return false;
+  const GCFreeFunction* callee =
+      Precompiler::LookupGCFreeFunction(call->function());
+  if (callee == nullptr) return false;
+  return !callee->may_throw ||
+         (call->GetBlock()->try_index() == kInvalidTryIndex);
+}
+
 void WriteBarrierElimination::UpdateVectorForBlock(BlockEntryInstr* entry,
                                                    bool finalize) {
   for (ForwardInstructionIterator it(entry); !it.Done(); it.Advance()) {
@@ -407,7 +435,10 @@ void WriteBarrierElimination::UpdateVectorForBlock(BlockEntryInstr* entry,
       }
     }
 
-    if (current->CanCallDart()) {
+    if (FLAG_write_barrier_elimination_across_calls &&
+        IsGCFreeCall(current)) {
+      // Nothing can be promoted or start marking during the call.
+    } else if (current->CanCallDart()) {
       vector_->Clear();
     } else if (current->CanTriggerGC()) {
       // Clear large array allocations. These are not added to the remembered
@@ -201,6 +201,8 @@ namespace dart {
   V(AllocateRecord_Wide,                   D, WIDE, lit, ___, ___)             \
   V(LoadRecordField,                       D, ORDN, num, ___, ___)             \
   V(LoadRecordField_Wide,                  D, WIDE, num, ___, ___)             \
+  V(JumpIfIntGe,                           T, ORDN, tgt, ___, ___)             \
+  V(JumpIfIntGe_Wide,                      T, WIDE, tgt, ___, ___)             \
 
   // These bytecodes are only generated within the VM. Reassigning their
   // opcodes is not a breaking change.
@@ -456,6 +458,8 @@ class KernelBytecode {
       case KernelBytecode::kCompareIntLt:
       case KernelBytecode::kCompareIntGe:
       case KernelBytecode::kCompareIntLe:
+      case KernelBytecode::kJumpIfIntGe:
+      case KernelBytecode::kJumpIfIntGe_Wide:
       case KernelBytecode::kAddDouble:
       case KernelBytecode::kSubDouble:
       case KernelBytecode::kMulDouble:
@@ -0,0 +1,485 @@
+// Copyright (c) 2026, the Dart project authors.  Please see the AUTHORS file
+// for details. All rights reserved. Use of this source code is governed by a
+// BSD-style license that can be found in the LICENSE file.
+
+#include "vm/coverage_bitmap.h"
+
+#include "vm/closure_functions_cache.h"
+#include "vm/dart.h"
+#include "vm/datastream.h"
+#include "vm/flags.h"
+#include "vm/hash_map.h"
+#include "vm/isolate.h"
+#include "vm/lockers.h"
+#include "vm/object.h"
+#include "vm/object_store.h"
+#include "vm/os.h"
+
+namespace dart {
+
+DEFINE_FLAG(charp,
+            write_coverage_bitmap_to,
+            nullptr,
+            "Write a compact bitmap of the coverage collected by each isolate "
+            "to <path>.<isolate port>.dcov when the isolate shuts down.");
+DEFINE_FLAG(int,
+            write_coverage_bitmap_every,
+            0,
+            "Also rewrite the --write_coverage_bitmap_to file after handling "
+            "a message if this many seconds have passed since it was last "
+            "written. 0 only writes it at shutdown.");
+
+// The coverage bitmap is a flat binary file; all integers are unsigned LEB128.
+//
+//   file     := "DCOV" version script_count script*
+//   script   := url_length url_bytes function_count function*
+//   function := start_pos length position_count delta* bitmap
+//
+// Every function which is instrumented for coverage has a record, whether or
+// not it was ever compiled, so that the totals computed from the file do not
+// depend on what happened to run. Classes which were never finalized have a
+// single record for the whole class. Records are sorted by start position.
+//
+// The positions of a function are the encoded coverage positions (see
+// TokenPosition::EncodeCoveragePosition) of its instrumented locations,
+// sorted and delta encoded. The bitmap that follows has one bit per position
+// (least significant bit first) which is set if the location was executed.
+// A function which was never compiled has no positions.
+static constexpr char kCoverageBitmapMagic[] = {'D', 'C', 'O', 'V'};
+static constexpr uint32_t kCoverageBitmapVersion = 1;
+
+namespace {
+
+struct RangeCoverage {
+  intptr_t start;
+  intptr_t end;
+  // Encoded coverage position shifted left by one, with the hit bit in the
+  // least significant bit.
+  ZoneGrowableArray<intptr_t>* entries;
+};
+
+struct ScriptCoverage {
+  const char* url;
+  ZoneGrowableArray<RangeCoverage>* ranges;
+};
+
+class CoverageBitmapBuilder : public ValueObject {
+ public:
+  explicit CoverageBitmapBuilder(Zone* zone)
+      : zone_(zone), script_indices_(zone), scripts_(zone, 64) {}
+
+  // Adds the range [start, end] of the script at |url| with the positions
+  // and hits from |coverage_array|, which may be null.
+  void AddRange(const String& url,
+                intptr_t start,
+                intptr_t end,
+                const Array& coverage_array);
+
+  void Write(BaseWriteStream* stream);
+
+ private:
+  Zone* zone_;
+  CStringIntMap script_indices_;
+  GrowableArray<ScriptCoverage> scripts_;
+
+  DISALLOW_COPY_AND_ASSIGN(CoverageBitmapBuilder);
+};
+
+}  // namespace
+
+void CoverageBitmapBuilder::AddRange(const String& url,
+                                     intptr_t start,
+                                     intptr_t end,
+                                     const Array& coverage_array) {
+  ASSERT(start <= end);
+  const char* url_cstr = url.ToCString();
+  intptr_t index = script_indices_.LookupValue(url_cstr);
+  if (index == CStringIntMapKeyValueTrait::kNoValue) {
+    index = scripts_.length();
+    script_indices_.Insert({url_cstr, index});
+    scripts_.Add(
+        {url_cstr, new (zone_) ZoneGrowableArray<RangeCoverage>(zone_, 16)});
+  }
+  const intptr_t length =
+      coverage_array.IsNull() ? 0 : coverage_array.Length() / 2;
+  auto* entries = new (zone_) ZoneGrowableArray<intptr_t>(zone_, length);
+  for (intptr_t i = 0; i < length; i++) {
+    const intptr_t encoded =
+        Smi::Value(Smi::RawCast(coverage_array.At(2 * i)));
+    bool is_branch_coverage;
+    if (!TokenPosition::DecodeCoveragePosition(encoded, &is_branch_coverage)
+             .IsReal()) {
+      continue;
+    }
+    const bool was_executed =
+        Smi::Value(Smi::RawCast(coverage_array.At(2 * i + 1))) != 0;
+    entries->Add((encoded << 1) | (was_executed ? 1 : 0));
+  }
+  scripts_[index].ranges->Add({start, end, entries});
+}
+
+static int CompareRanges(const RangeCoverage* a, const RangeCoverage* b) {
+  if (a->start != b->start) return a->start < b->start ? -1 : 1;
+  if (a->end != b->end) return a->end < b->end ? -1 : 1;
+  return 0;
+}
+
+static int CompareEntries(const intptr_t* a, const intptr_t* b) {
+  if (*a < *b) return -1;
+  if (*a > *b) return 1;
+  return 0;
+}
+
+void CoverageBitmapBuilder::Write(BaseWriteStream* stream) {
+  stream->WriteBytes(kCoverageBitmapMagic, sizeof(kCoverageBitmapMagic));
+  stream->WriteLEB128(kCoverageBitmapVersion);
+  stream->WriteLEB128(static_cast<uintptr_t>(scripts_.length()));
+  for (intptr_t s = 0; s < scripts_.length(); s++) {
+    const ScriptCoverage& script = scripts_[s];
+    ZoneGrowableArray<RangeCoverage>* ranges = script.ranges;
+    ranges->Sort(CompareRanges);
+    // A function may have been compiled more than once (e.g. inlined into
+    // several callers in AOT mode); merge its records.
+    intptr_t range_count = 0;
+    for (intptr_t i = 0; i < ranges->length(); i++) {
+      const RangeCoverage& range = (*ranges)[i];
+      if (range_count > 0 &&
+          CompareRanges(&(*ranges)[range_count - 1], &range) == 0) {
+        (*ranges)[range_count - 1].entries->AddArray(*range.entries);
+      } else {
+        (*ranges)[range_count++] = range;
+      }
+    }
+    ranges->TruncateTo(range_count);
+
+    const intptr_t url_length = strlen(script.url);
+    stream->WriteLEB128(static_cast<uintptr_t>(url_length));
+    stream->WriteBytes(script.url, url_length);
+    stream->WriteLEB128(static_cast<uintptr_t>(range_count));
+    for (intptr_t r = 0; r < range_count; r++) {
+      const RangeCoverage& range = (*ranges)[r];
+      ZoneGrowableArray<intptr_t>* entries = range.entries;
+      entries->Sort(CompareEntries);
+      // Merge duplicate locations so that a hit in either record wins.
+      intptr_t count = 0;
+      for (intptr_t i = 0; i < entries->length(); i++) {
+        const intptr_t entry = (*entries)[i];
+        if (count > 0 && ((*entries)[count - 1] >> 1) == (entry >> 1)) {
+          (*entries)[count - 1] |= entry;
+        } else {
+          (*entries)[count++] = entry;
+        }
+      }
+      entries->TruncateTo(count);
+
+      stream->WriteLEB128(static_cast<uintptr_t>(range.start));
+      stream->WriteLEB128(static_cast<uintptr_t>(range.end - range.start));
+      stream->WriteLEB128(static_cast<uintptr_t>(count));
+      intptr_t previous = 0;
+      for (intptr_t i = 0; i < count; i++) {
+        const intptr_t position = (*entries)[i] >> 1;
+        stream->WriteLEB128(static_cast<uintptr_t>(position - previous));
+        previous = position;
+      }
+      uint8_t bits = 0;
+      for (intptr_t i = 0; i < count; i++) {
+        bits |=
+            static_cast<uint8_t>(((*entries)[i] & 1) << (i % kBitsPerByte));
+        if ((i % kBitsPerByte) == (kBitsPerByte - 1)) {
+          stream->WriteByte(bits);
+          bits = 0;
+        }
+      }
+      if ((count % kBitsPerByte) != 0) {
+        stream->WriteByte(bits);
+      }
+    }
+  }
+}
+
+#if !defined(DART_PRECOMPILED_RUNTIME)
+// Whether |function| is instrumented for coverage. Mirrors the functions
+// which SourceReport includes in coverage reports.
+static bool IsInstrumented(Thread* thread, const Function& function) {
+  if (!function.token_pos().IsReal() || !function.end_token_pos().IsReal()) {
+    return false;
+  }
+  // These don't have unoptimized code and are only used for synthetic stubs.
+  if (function.ForceOptimize()) return false;
+
+  switch (function.kind()) {
+    case UntaggedFunction::kRegularFunction:
+    case UntaggedFunction::kClosureFunction:
+    case UntaggedFunction::kImplicitClosureFunction:
+    case UntaggedFunction::kImplicitStaticGetter:
+    case UntaggedFunction::kFieldInitializer:
+    case UntaggedFunction::kGetterFunction:
+    case UntaggedFunction::kSetterFunction:
+    case UntaggedFunction::kConstructor:
+      break;
+    default:
+      return false;
+  }
+  if (function.is_abstract() || function.IsImplicitConstructor() ||
+      function.is_synthetic() || function.is_redirecting_factory()) {
+    return false;
+  }
+  if (function.IsNonImplicitClosureFunction() &&
+      (function.context_scope() == ContextScope::null())) {
+    // The enclosing function was never compiled.
+    return false;
+  }
+
+  if (function.kind() == UntaggedFunction::kConstructor) {
+    Zone* zone = thread->zone();
+    const Class& cls = Class::Handle(zone, function.Owner());
+    // Enum constructors cannot be invoked by the user.
+    if (function.IsGenerativeConstructor() && cls.is_enum_class()) {
+      return false;
+    }
+    // Private constructors which only prevent a static utility class from
+    // being instantiated (see #47021).
+    if (function.NumParameters() == function.NumImplicitParameters() &&
+        function.IsPrivate() && cls.is_abstract() &&
+        !cls.HasInstanceFields()) {
+      SafepointReadRwLocker ml(thread, thread->isolate_group()->program_lock());
+      const GrowableObjectArray& subclasses =
+          GrowableObjectArray::Handle(zone, cls.direct_subclasses());
+      if (subclasses.IsNull() || subclasses.Length() == 0) {
+        const Array& functions = Array::Handle(zone, cls.functions());
+        Function& other = Function::Handle(zone);
+        intptr_t non_static_functions = 0;
+        for (intptr_t i = 0; i < functions.Length(); i++) {
+          other ^= functions.At(i);
+          if (!other.IsStaticFunction()) {
+            non_static_functions++;
+          }
+        }
+        if (non_static_functions == 1) {
+          return false;
+        }
+      }
+    }
+  }
+  return true;
+}
+
+// Calls |visit_function| for every instrumented function of the program and
+// |visit_unfinalized_class| for every class whose functions were never
+// loaded.
+template <typename FunctionVisitor, typename ClassVisitor>
+static void VisitInstrumentedFunctions(
+    Thread* thread,
+    const FunctionVisitor& visit_function,
+    const ClassVisitor& visit_unfinalized_class) {
+  Zone* zone = thread->zone();
+  const GrowableObjectArray& libs = GrowableObjectArray::Handle(
+      zone, thread->isolate_group()->object_store()->libraries());
+  Library& lib = Library::Handle(zone);
+  Class& cls = Class::Handle(zone);
+  Array& functions = Array::Handle(zone);
+  Array& fields = Array::Handle(zone);
+  Function& function = Function::Handle(zone);
+  Field& field = Field::Handle(zone);
+  for (intptr_t i = 0; i < libs.Length(); i++) {
+    lib ^= libs.At(i);
+    ClassDictionaryIterator it(lib, ClassDictionaryIterator::kIteratePrivate);
+    while (it.HasNext()) {
+      cls = it.GetNextClass();
+      if (!cls.is_finalized()) {
+        cls.EnsureDeclarationLoaded();
+        visit_unfinalized_class(cls);
+        continue;
+      }
+      functions = cls.current_functions();
+      for (intptr_t j = 0; j < functions.Length(); j++) {
+        function ^= functions.At(j);
+        // Skip getter functions of static const fields.
+        if (function.kind() == UntaggedFunction::kImplicitStaticGetter) {
+          field ^= function.accessor_field();
+          if (field.is_const() && field.is_static()) {
+            continue;
+          }
+        }
+        if (IsInstrumented(thread, function)) {
+          visit_function(function);
+        }
+      }
+      fields = cls.fields();
+      for (intptr_t j = 0; j < fields.Length(); j++) {
+        field ^= fields.At(j);
+        if (!field.token_pos().IsReal() || !field.end_token_pos().IsReal() ||
+            !field.HasInitializerFunction()) {
+          continue;
+        }
+        function = field.InitializerFunction();
+        if (IsInstrumented(thread, function)) {
+          visit_function(function);
+        }
+      }
+    }
+  }
+  ClosureFunctionsCache::ForAllClosureFunctions([&](const Function& closure) {
+    if (IsInstrumented(thread, closure)) {
+      visit_function(closure);
+    }
+    return true;  // Continue iteration.
+  });
+}
+
+static void AddUnfinalizedClass(CoverageBitmapBuilder* builder,
+                                const Class& cls) {
+  if (!cls.token_pos().IsReal() || !cls.end_token_pos().IsReal()) return;
+  const Script& script = Script::Handle(cls.script());
+  if (script.IsNull()) return;
+  builder->AddRange(String::Handle(script.url()), cls.token_pos().Pos(),
+                    cls.end_token_pos().Pos(), Object::null_array());
+}
+#endif  // !defined(DART_PRECOMPILED_RUNTIME)
+
+bool CoverageBitmap::IsEnabled(Isolate* isolate) {
+  if ((FLAG_write_coverage_bitmap_to == nullptr) ||
+      Isolate::IsSystemIsolate(isolate)) {
+    return false;
+  }
+#if defined(DART_PRECOMPILED_RUNTIME)
+  return isolate->group()->object_store()->aot_coverage() != Array::null();
+#else
+  // Unoptimized JIT code only records coverage in non-product mode.
+  return isolate->group()->coverage();
+#endif
+}
+
+void CoverageBitmap::Write(Thread* thread, BaseWriteStream* stream) {
+  Zone* zone = thread->zone();
+  CoverageBitmapBuilder builder(zone);
+#if defined(DART_PRECOMPILED_RUNTIME)
+  const Array& table = Array::Handle(
+      zone, thread->isolate_group()->object_store()->aot_coverage());
+  if (!table.IsNull()) {
+    String& url = String::Handle(zone);
+    Array& coverage_array = Array::Handle(zone);
+    for (intptr_t i = 0; i < table.Length(); i += 4) {
+      url ^= table.At(i);
+      coverage_array ^= table.At(i + 3);
+      builder.AddRange(url, Smi::Value(Smi::RawCast(table.At(i + 1))),
+                       Smi::Value(Smi::RawCast(table.At(i + 2))),
+                       coverage_array);
+    }
+  }
+#else
+  Script& script = Script::Handle(zone);
+  String& url = String::Handle(zone);
+  Array& coverage_array = Array::Handle(zone);
+  VisitInstrumentedFunctions(
+      thread,
+      [&](const Function& function) {
+        script = function.script();
+        if (script.IsNull()) return;
+        url = script.url();
+        coverage_array = function.GetCoverageArray();
+        builder.AddRange(url, function.token_pos().Pos(),
+                         function.end_token_pos().Pos(), coverage_array);
+      },
+      [&](const Class& cls) { AddUnfinalizedClass(&builder, cls); });
+#endif  // defined(DART_PRECOMPILED_RUNTIME)
+  builder.Write(stream);
+}
+
+void CoverageBitmap::WriteToFile(Thread* thread) {
+  auto file_open = Dart::file_open_callback();
+  auto file_write = Dart::file_write_callback();
+  auto file_close = Dart::file_close_callback();
+  if ((file_open == nullptr) || (file_write == nullptr) ||
+      (file_close == nullptr)) {
+    OS::PrintErr("warning: Could not access file callbacks.\n");
+    return;
+  }
+
+  MallocWriteStream stream(KB);
+  Write(thread, &stream);
+
+  Isolate* isolate = thread->isolate();
+  const char* filename =
+      OS::SCreate(thread->zone(), "%s.%" Pd64 ".dcov",
+                  FLAG_write_coverage_bitmap_to, isolate->main_port());
+  void* file = file_open(filename, /*write=*/true);
+  if (file == nullptr) {
+    OS::PrintErr("warning: Failed to write coverage bitmap: %s\n", filename);
+    return;
+  }
+  file_write(stream.buffer(), stream.bytes_written(), file);
+  file_close(file);
+  isolate->set_last_coverage_bitmap_flush_micros(
+      OS::GetCurrentMonotonicMicros());
+}
+
+void CoverageBitmap::MaybeFlush(Thread* thread) {
+  if (FLAG_write_coverage_bitmap_every <= 0) return;
+  Isolate* isolate = thread->isolate();
+  if (!IsEnabled(isolate)) return;
+  const int64_t now = OS::GetCurrentMonotonicMicros();
+  if (isolate->last_coverage_bitmap_flush_micros() == 0) {
+    // Count the interval from the first message.
+    isolate->set_last_coverage_bitmap_flush_micros(now);
+    return;
+  }
+  if ((now - isolate->last_coverage_bitmap_flush_micros()) <
+      FLAG_write_coverage_bitmap_every * kMicrosecondsPerSecond) {
+    return;
+  }
+  WriteToFile(thread);
+}
+
+#if !defined(DART_PRECOMPILED_RUNTIME)
+ArrayPtr CoverageBitmap::CreateAotTable(
+    Thread* thread,
+    const GrowableObjectArray& coverage_arrays) {
+  Zone* zone = thread->zone();
+  const GrowableObjectArray& table =
+      GrowableObjectArray::Handle(zone, GrowableObjectArray::New());
+  Script& script = Script::Handle(zone);
+  Smi& position = Smi::Handle(zone);
+  auto add_record = [&](const Script& owner, TokenPosition start,
+                        TokenPosition end, const Object& coverage_array) {
+    table.Add(String::Handle(zone, owner.url()));
+    position = Smi::New(start.Pos());
+    table.Add(position);
+    position = Smi::New(end.Pos());
+    table.Add(position);
+    table.Add(coverage_array);
+  };
+
+  Function& compiled = Function::Handle(zone);
+  Array& coverage_array = Array::Handle(zone);
+  for (intptr_t i = 0; i < coverage_arrays.Length(); i += 2) {
+    compiled ^= coverage_arrays.At(i);
+    coverage_array ^= coverage_arrays.At(i + 1);
+    if (!IsInstrumented(thread, compiled)) continue;
+    script = compiled.script();
+    if (script.IsNull()) continue;
+    add_record(script, compiled.token_pos(), compiled.end_token_pos(),
+               coverage_array);
+  }
+  // The writer merges these with the records above, so that functions which
+  // were never compiled still count as instrumented.
+  VisitInstrumentedFunctions(
+      thread,
+      [&](const Function& function) {
+        script = function.script();
+        if (script.IsNull()) return;
+        add_record(script, function.token_pos(), function.end_token_pos(),
+                   Object::null_object());
+      },
+      [&](const Class& cls) {
+        if (!cls.token_pos().IsReal() || !cls.end_token_pos().IsReal()) return;
+        script = cls.script();
+        if (script.IsNull()) return;
+        add_record(script, cls.token_pos(), cls.end_token_pos(),
+                   Object::null_object());
+      });
+  return Array::MakeFixedLength(table);
+}
+#endif  // !defined(DART_PRECOMPILED_RUNTIME)
+
+}  // namespace dart
@@ -0,0 +1,61 @@
+// Copyright (c) 2026, the Dart project authors.  Please see the AUTHORS file
+// for details. All rights reserved. Use of this source code is governed by a
+// BSD-style license that can be found in the LICENSE file.
+
+#ifndef RUNTIME_VM_COVERAGE_BITMAP_H_
+#define RUNTIME_VM_COVERAGE_BITMAP_H_
+
+#include "vm/allocation.h"
+#include "vm/tagged_pointer.h"
+
+namespace dart {
+
+class BaseWriteStream;
+class GrowableObjectArray;
+class Isolate;
+class Thread;
+
+// Writes the coverage collected by an isolate as a compact per-function hit
+// bitmap (format described in coverage_bitmap.cc) to the file given by
+// --write_coverage_bitmap_to. Unlike the service protocol's SourceReport this
+// never compiles anything, so it is cheap enough to run at isolate shutdown.
+// Bitmaps from several runs can be merged offline with
+// runtime/tools/merge_coverage_bitmaps.py.
+//
+// In JIT mode the positions and hits come from the per-function coverage
+// arrays created when the unoptimized code was built. Optimized code keeps
+// storing into the same arrays through its RecordCoverage instructions; it has
+// no separate per-block hit bits. Precompiled code only records coverage when the snapshot
+// was built with --aot-coverage, which stores a table of all coverage arrays
+// in the object store (see CreateAotTable).
+class CoverageBitmap : public AllStatic {
+ public:
+  // Whether the code run by |isolate| records coverage which should be
+  // written out.
+  static bool IsEnabled(Isolate* isolate);
+
+  static void Write(Thread* thread, BaseWriteStream* stream);
+
+  // Writes the bitmap of the current isolate to
+  // <--write_coverage_bitmap_to>.<isolate port>.dcov, replacing the output of
+  // any previous flush.
+  static void WriteToFile(Thread* thread);
+
+  // Rewrites the file if --write_coverage_bitmap_every seconds have passed
+  // since the last flush, so that coverage survives isolates which never
+  // shut down cleanly.
+  static void MaybeFlush(Thread* thread);
+
+#if !defined(DART_PRECOMPILED_RUNTIME)
+  // Creates the table of (url, start position, end position, coverage array)
+  // records written to AOT snapshots. |coverage_arrays| holds pairs of a
+  // function and a coverage array created while compiling it. Functions
+  // which were never compiled get a record without an array.
+  static ArrayPtr CreateAotTable(Thread* thread,
+                                 const GrowableObjectArray& coverage_arrays);
+#endif  // !defined(DART_PRECOMPILED_RUNTIME)
+};
+
+}  // namespace dart
+
+#endif  // RUNTIME_VM_COVERAGE_BITMAP_H_
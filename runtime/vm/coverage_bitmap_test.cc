@@ -0,0 +1,113 @@
+// Copyright (c) 2026, the Dart project authors.  Please see the AUTHORS file
+// for details. All rights reserved. Use of this source code is governed by a
+// BSD-style license that can be found in the LICENSE file.
+
+#include "vm/coverage_bitmap.h"
+#include "vm/dart_api_impl.h"
+#include "vm/datastream.h"
+#include "vm/unit_test.h"
+
+namespace dart {
+
+#if !defined(PRODUCT) && !defined(DART_PRECOMPILED_RUNTIME)
+
+static ObjectPtr ExecuteScript(const char* script) {
+  Dart_Handle lib;
+  {
+    TransitionVMToNative transition(Thread::Current());
+    lib = TestCase::LoadTestScript(script, nullptr);
+    EXPECT_VALID(lib);
+    Dart_Handle result = Dart_Invoke(lib, NewString("main"), 0, nullptr);
+    EXPECT_VALID(result);
+  }
+  return Api::UnwrapHandle(lib);
+}
+
+static intptr_t FunctionStart(const Library& lib, const char* name) {
+  const Function& function = Function::Handle(
+      lib.LookupFunctionAllowPrivate(String::Handle(String::New(name))));
+  EXPECT(!function.IsNull());
+  return function.token_pos().Pos();
+}
+
+ISOLATE_UNIT_TEST_CASE(CoverageBitmap_Write) {
+  const char* kScript =
+      "helper0() {}\n"
+      "helper1() {}\n"
+      "unused() {}\n"
+      "main() {\n"
+      "  if (true) {\n"
+      "    helper0();\n"
+      "  } else {\n"
+      "    helper1();\n"
+      "  }\n"
+      "}";
+
+  Library& lib = Library::Handle();
+  lib ^= ExecuteScript(kScript);
+  ASSERT(!lib.IsNull());
+  const intptr_t unused_start = FunctionStart(lib, "unused");
+  const intptr_t main_start = FunctionStart(lib, "main");
+
+  MallocWriteStream stream(KB);
+  CoverageBitmap::Write(thread, &stream);
+
+  ReadStream reader(stream.buffer(), stream.bytes_written());
+  char magic[4];
+  reader.ReadBytes(magic, sizeof(magic));
+  EXPECT(memcmp(magic, "DCOV", sizeof(magic)) == 0);
+  EXPECT_EQ(1u, reader.ReadLEB128<uint32_t>());
+  const uintptr_t script_count = reader.ReadLEB128<uintptr_t>();
+  bool found_script = false;
+  bool found_unused = false;
+  bool found_main = false;
+  for (uintptr_t i = 0; i < script_count; i++) {
+    const uintptr_t url_length = reader.ReadLEB128<uintptr_t>();
+    char* url = thread->zone()->Alloc<char>(url_length + 1);
+    reader.ReadBytes(url, url_length);
+    url[url_length] = '\0';
+    const bool is_test_script = strcmp(url, RESOLVED_USER_TEST_URI) == 0;
+    found_script = found_script || is_test_script;
+    const uintptr_t function_count = reader.ReadLEB128<uintptr_t>();
+    uintptr_t previous_start = 0;
+    for (uintptr_t f = 0; f < function_count; f++) {
+      const uintptr_t start = reader.ReadLEB128<uintptr_t>();
+      reader.ReadLEB128<uintptr_t>();  // Length.
+      EXPECT_LE(previous_start, start);
+      previous_start = start;
+      const uintptr_t count = reader.ReadLEB128<uintptr_t>();
+      for (uintptr_t j = 0; j < count; j++) {
+        // Deltas are unsigned, so positions are strictly increasing after
+        // the first one.
+        const uintptr_t delta = reader.ReadLEB128<uintptr_t>();
+        EXPECT(j == 0 || delta > 0);
+      }
+      intptr_t hits = 0;
+      for (uintptr_t j = 0; j < (count + kBitsPerByte - 1) / kBitsPerByte;
+           j++) {
+        uint8_t bits;
+        reader.ReadBytes(&bits, 1);
+        hits += Utils::CountOneBitsWord(bits);
+      }
+      if (!is_test_script) continue;
+      if (static_cast<intptr_t>(start) == unused_start) {
+        found_unused = true;
+        // Never compiled, but still listed so that it counts as uncovered.
+        EXPECT_EQ(0u, count);
+      } else if (static_cast<intptr_t>(start) == main_start) {
+        found_main = true;
+        // The call to helper0 ran, the call to helper1 did not.
+        EXPECT_LE(1, hits);
+        EXPECT_LT(hits, static_cast<intptr_t>(count));
+      }
+    }
+  }
+  EXPECT(found_script);
+  EXPECT(found_unused);
+  EXPECT(found_main);
+  EXPECT_EQ(0, reader.PendingBytes());
+}
+
+#endif  // !defined(PRODUCT) && !defined(DART_PRECOMPILED_RUNTIME)
+
+}  // namespace dart
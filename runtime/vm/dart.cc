@@ -42,6 +42,7 @@
 #include "vm/profiler.h"
 #include "vm/raw_object_fields.h"
 #include "vm/reverse_pc_lookup_cache.h"
+#include "vm/safepoint_poll_page.h"
 #include "vm/service_isolate.h"
 #include "vm/simulator.h"
 #include "vm/snapshot.h"
@@ -318,6 +319,10 @@ char* Dart::DartInit(const Dart_InitializeParams* params) {
 #else
   VirtualMemory::Init();
 #endif
+  char* error = SafepointPollPage::Init();
+  if (error != nullptr) {
+    return error;
+  }
 
 #if defined(DART_PRECOMPILED_RUNTIME) && defined(DART_TARGET_OS_LINUX)
   if (VirtualMemory::PageSize() > kElfPageSize) {
@@ -792,6 +797,7 @@ char* Dart::Cleanup() {
   IsolateGroupReloadContext::SetFileModifiedCallback(nullptr);
   Service::SetEmbedderStreamCallbacks(nullptr, nullptr);
 #endif  // !defined(PRODUCT) && !defined(DART_PRECOMPILED_RUNTIME)
+  SafepointPollPage::Cleanup();
   VirtualMemory::Cleanup();
   return nullptr;
 }
@@ -1196,7 +1196,6 @@ DART_EXPORT bool Dart_IsVMFlagSet(const char* flag_name) {
 DART_API_ISOLATE_GROUP_METRIC_LIST(ISOLATE_GROUP_METRIC_API)
 #undef ISOLATE_GROUP_METRIC_API
 
-#if !defined(PRODUCT)
 #define ISOLATE_METRIC_API(type, variable, name, unit)                         \
   DART_EXPORT int64_t Dart_Isolate##variable##Metric(Dart_Isolate isolate) {   \
     if (isolate == nullptr) {                                                  \
@@ -1207,14 +1206,6 @@ DART_API_ISOLATE_GROUP_METRIC_LIST(ISOLATE_GROUP_METRIC_API)
   }
 ISOLATE_METRIC_LIST(ISOLATE_METRIC_API)
 #undef ISOLATE_METRIC_API
-#else  // !defined(PRODUCT)
-#define ISOLATE_METRIC_API(type, variable, name, unit)                         \
-  DART_EXPORT int64_t Dart_Isolate##variable##Metric(Dart_Isolate isolate) {   \
-    return -1;                                                                 \
-  }
-ISOLATE_METRIC_LIST(ISOLATE_METRIC_API)
-#undef ISOLATE_METRIC_API
-#endif  // !defined(PRODUCT)
 
 // --- Isolates ---
 
@@ -2893,6 +2884,43 @@ DART_EXPORT Dart_Handle Dart_NewStringFromUTF8(const uint8_t* utf8_array,
   return Api::NewHandle(T, String::FromUTF8(utf8_array, length));
 }
 
+DART_EXPORT Dart_Handle
+Dart_NewListOfStringsFromUTF8(const uint8_t* const* utf8_arrays,
+                              const intptr_t* lengths,
+                              intptr_t count) {
+  DARTSCOPE(Thread::Current());
+  API_TIMELINE_DURATION(T);
+  CHECK_LENGTH(count, Array::kMaxElements);
+  if (count != 0) {
+    if (utf8_arrays == nullptr) {
+      RETURN_NULL_ERROR(utf8_arrays);
+    }
+    if (lengths == nullptr) {
+      RETURN_NULL_ERROR(lengths);
+    }
+  }
+  for (intptr_t i = 0; i < count; i++) {
+    if (utf8_arrays[i] == nullptr && lengths[i] != 0) {
+      return Api::NewError("%s expects argument 'utf8_arrays' to be non-null.",
+                           CURRENT_FUNC);
+    }
+    CHECK_LENGTH(lengths[i], String::kMaxElements);
+    if (!Utf8::IsValid(utf8_arrays[i], lengths[i])) {
+      return Api::NewError(
+          "%s expects argument 'utf8_arrays' to be valid UTF-8.",
+          CURRENT_FUNC);
+    }
+  }
+  CHECK_CALLBACK_STATE(T);
+  const Array& result = Array::Handle(Z, Array::New(count));
+  String& str = String::Handle(Z);
+  for (intptr_t i = 0; i < count; i++) {
+    str = String::FromUTF8(utf8_arrays[i], lengths[i]);
+    result.SetAt(i, str);
+  }
+  return Api::NewHandle(T, result.ptr());
+}
+
 DART_EXPORT Dart_Handle Dart_NewStringFromUTF16(const uint16_t* utf16_array,
                                                 intptr_t length) {
   DARTSCOPE(Thread::Current());
@@ -4680,6 +4708,152 @@ DART_EXPORT Dart_Handle Dart_InvokeClosure(Dart_Handle closure,
   return Api::NewHandle(T, DartEntry::InvokeClosure(T, args));
 }
 
+// The state behind a Dart_ClosureInvocation. The arguments array (with the
+// closure as its first element), its arguments descriptor and the function
+// the closure resolved to are kept alive by persistent handles.
+class ClosureInvocation {
+ public:
+  ClosureInvocation(Isolate* isolate,
+                    ApiState* state,
+                    const Array& arguments,
+                    const Array& arguments_descriptor,
+                    const Function& function)
+      : isolate_(isolate),
+        arguments_(state->AllocatePersistentHandle()),
+        arguments_descriptor_(state->AllocatePersistentHandle()),
+        function_(state->AllocatePersistentHandle()) {
+    arguments_->set_ptr(arguments);
+    arguments_descriptor_->set_ptr(arguments_descriptor);
+    function_->set_ptr(function);
+  }
+
+  void Free(ApiState* state) {
+    state->FreePersistentHandle(arguments_);
+    state->FreePersistentHandle(arguments_descriptor_);
+    state->FreePersistentHandle(function_);
+  }
+
+  Isolate* isolate() const { return isolate_; }
+  ArrayPtr arguments() const { return Array::RawCast(arguments_->ptr()); }
+  ArrayPtr arguments_descriptor() const {
+    return Array::RawCast(arguments_descriptor_->ptr());
+  }
+  FunctionPtr function() const { return Function::RawCast(function_->ptr()); }
+
+  static ClosureInvocation* Cast(Dart_ClosureInvocation invocation) {
+    return reinterpret_cast<ClosureInvocation*>(invocation);
+  }
+  Dart_ClosureInvocation apiHandle() {
+    return reinterpret_cast<Dart_ClosureInvocation>(this);
+  }
+
+ private:
+  Isolate* const isolate_;
+  PersistentHandle* const arguments_;
+  PersistentHandle* const arguments_descriptor_;
+  PersistentHandle* const function_;
+
+  DISALLOW_COPY_AND_ASSIGN(ClosureInvocation);
+};
+
+DART_EXPORT Dart_Handle
+Dart_NewClosureInvocation(Dart_Handle closure,
+                          int number_of_arguments,
+                          Dart_ClosureInvocation* invocation) {
+  DARTSCOPE(Thread::Current());
+  API_TIMELINE_DURATION(T);
+  CHECK_CALLBACK_STATE(T);
+  const Instance& closure_obj = Api::UnwrapInstanceHandle(Z, closure);
+  if (closure_obj.IsNull() || !closure_obj.IsCallable(nullptr)) {
+    RETURN_TYPE_ERROR(Z, closure, Instance);
+  }
+  if (number_of_arguments < 0) {
+    return Api::NewError(
+        "%s expects argument 'number_of_arguments' to be non-negative.",
+        CURRENT_FUNC);
+  }
+  if (invocation == nullptr) {
+    RETURN_NULL_ERROR(invocation);
+  }
+
+  const Array& args = Array::Handle(Z, Array::New(number_of_arguments + 1));
+  args.SetAt(0, closure_obj);
+  const int kTypeArgsLen = 0;
+  const Array& args_desc = Array::Handle(
+      Z, ArgumentsDescriptor::NewBoxed(kTypeArgsLen, args.Length()));
+  // Resolving may replace the first argument by the result of a call getter.
+  const Object& resolved =
+      Object::Handle(Z, DartEntry::ResolveCallable(T, args, args_desc));
+  if (resolved.IsError()) {
+    return Api::NewHandle(T, resolved.ptr());
+  }
+  const Function& function =
+      Function::Handle(Z, Function::RawCast(resolved.ptr()));
+
+  Isolate* I = T->isolate();
+  auto* result = new ClosureInvocation(I, I->group()->api_state(), args,
+                                       args_desc, function);
+  *invocation = result->apiHandle();
+  return Api::Success();
+}
+
+DART_EXPORT Dart_Handle
+Dart_InvokeClosureInvocation(Dart_ClosureInvocation invocation,
+                             Dart_Handle* arguments) {
+  DARTSCOPE(Thread::Current());
+  API_TIMELINE_DURATION(T);
+  CHECK_CALLBACK_STATE(T);
+  if (invocation == nullptr) {
+    RETURN_NULL_ERROR(invocation);
+  }
+  ClosureInvocation* state = ClosureInvocation::Cast(invocation);
+  if (state->isolate() != T->isolate()) {
+    return Api::NewError(
+        "%s expects argument 'invocation' to belong to the current isolate.",
+        CURRENT_FUNC);
+  }
+
+  Array& args = Array::Handle(Z, state->arguments());
+  if (arguments != nullptr) {
+    Object& obj = Object::Handle(Z);
+    // Check every argument before storing any, so that a type error leaves
+    // the arguments of the previous call in place.
+    for (intptr_t i = 1; i < args.Length(); i++) {
+      obj = Api::UnwrapHandle(arguments[i - 1]);
+      if (!obj.IsNull() && !obj.IsInstance()) {
+        RETURN_TYPE_ERROR(Z, arguments[i - 1], Instance);
+      }
+    }
+    for (intptr_t i = 1; i < args.Length(); i++) {
+      obj = Api::UnwrapHandle(arguments[i - 1]);
+      args.SetAt(i, obj);
+    }
+  }
+  const Function& function = Function::Handle(Z, state->function());
+  if (function.IsNull()) {
+    // noSuchMethod gets the arguments array inside its Invocation, which
+    // may outlive this call, so it must not see later arguments.
+    args = args.Copy();
+  }
+  const Array& args_desc = Array::Handle(Z, state->arguments_descriptor());
+  return Api::NewHandle(
+      T, DartEntry::InvokeCallable(T, function, args, args_desc));
+}
+
+DART_EXPORT void Dart_DeleteClosureInvocation(
+    Dart_ClosureInvocation invocation) {
+  Thread* T = Thread::Current();
+  IsolateGroup* isolate_group = T->isolate_group();
+  CHECK_ISOLATE_GROUP(isolate_group);
+  if (invocation == nullptr) {
+    FATAL("%s expects argument 'invocation' to be non-null.", CURRENT_FUNC);
+  }
+  TransitionToVM transition(T);
+  ClosureInvocation* state = ClosureInvocation::Cast(invocation);
+  state->Free(isolate_group->api_state());
+  delete state;
+}
+
 DART_EXPORT Dart_Handle Dart_GetField(Dart_Handle container, Dart_Handle name) {
   DARTSCOPE(Thread::Current());
   API_TIMELINE_DURATION(T);
@@ -1678,6 +1678,44 @@ TEST_CASE(DartAPI_NewString) {
   EXPECT(Dart_IsError(invalid_str));
 }
 
+TEST_CASE(DartAPI_NewListOfStringsFromUTF8) {
+  const uint8_t ascii[] = {'a', 'b', 'c'};
+  const uint8_t two_byte[] = {0xE4, 0xBA, 0x8c};  // U+4E8C.
+  const uint8_t* strings[] = {ascii, two_byte, nullptr};
+  const intptr_t lengths[] = {ARRAY_SIZE(ascii), ARRAY_SIZE(two_byte), 0};
+
+  Dart_Handle list = Dart_NewListOfStringsFromUTF8(strings, lengths, 3);
+  EXPECT_VALID(list);
+  EXPECT(Dart_IsList(list));
+  intptr_t length = 0;
+  EXPECT_VALID(Dart_ListLength(list, &length));
+  EXPECT_EQ(3, length);
+
+  const char* expected[] = {"abc", "\xE4\xBA\x8c", ""};
+  for (intptr_t i = 0; i < 3; i++) {
+    Dart_Handle str = Dart_ListGetAt(list, i);
+    EXPECT_VALID(str);
+    EXPECT(Dart_IsString(str));
+    const char* cstr = nullptr;
+    EXPECT_VALID(Dart_StringToCString(str, &cstr));
+    EXPECT_STREQ(expected[i], cstr);
+  }
+
+  Dart_Handle empty = Dart_NewListOfStringsFromUTF8(nullptr, nullptr, 0);
+  EXPECT_VALID(empty);
+  EXPECT_VALID(Dart_ListLength(empty, &length));
+  EXPECT_EQ(0, length);
+
+  const uint8_t invalid[] = {0xE4, 0xBA};  // underflow.
+  strings[1] = invalid;
+  const intptr_t invalid_lengths[] = {ARRAY_SIZE(ascii), ARRAY_SIZE(invalid),
+                                      0};
+  EXPECT(Dart_IsError(
+      Dart_NewListOfStringsFromUTF8(strings, invalid_lengths, 3)));
+  EXPECT(Dart_IsError(Dart_NewListOfStringsFromUTF8(nullptr, lengths, 3)));
+  EXPECT(Dart_IsError(Dart_NewListOfStringsFromUTF8(strings, lengths, -1)));
+}
+
 TEST_CASE(DartAPI_MalformedStringToUTF8) {
   // 1D11E = treble clef
   // [0] should be high surrogate D834
@@ -7232,6 +7270,80 @@ TEST_CASE(DartAPI_InvokeClosure) {
   EXPECT(Dart_ErrorHasException(result));
 }
 
+TEST_CASE(DartAPI_ClosureInvocation) {
+  const char* kScriptChars =
+      "class Adder {\n"
+      "  int call(int i, int j) => i + j;\n"
+      "}\n"
+      "@pragma('vm:entry-point', 'call')\n"
+      "Function makeClosure(int k) => (int i, int j) => i * j + k;\n"
+      "@pragma('vm:entry-point', 'call')\n"
+      "Adder makeAdder() => Adder();\n";
+  CHECK_API_SCOPE(thread);
+  Dart_Handle lib = TestCase::LoadTestScript(kScriptChars, nullptr);
+  EXPECT_VALID(lib);
+
+  Dart_Handle dart_arguments[1] = {Dart_NewInteger(7)};
+  Dart_Handle closure = Dart_Invoke(lib, NewString("makeClosure"), 1,
+                                    dart_arguments);
+  EXPECT_VALID(closure);
+
+  Dart_ClosureInvocation invocation = nullptr;
+  EXPECT_ERROR(Dart_NewClosureInvocation(Dart_NewInteger(1), 2, &invocation),
+               "Dart_NewClosureInvocation expects argument 'closure' to be "
+               "of type Instance.");
+  EXPECT_ERROR(Dart_NewClosureInvocation(closure, -1, &invocation),
+               "Dart_NewClosureInvocation expects argument "
+               "'number_of_arguments' to be non-negative.");
+  EXPECT(invocation == nullptr);
+  EXPECT_VALID(Dart_NewClosureInvocation(closure, 2, &invocation));
+  EXPECT(invocation != nullptr);
+
+  // The same invocation can be called repeatedly with new arguments, across
+  // API scopes.
+  int64_t value = 0;
+  for (intptr_t i = 0; i < 10; i++) {
+    Dart_EnterScope();
+    Dart_Handle args[2] = {Dart_NewInteger(i), Dart_NewInteger(3)};
+    Dart_Handle result = Dart_InvokeClosureInvocation(invocation, args);
+    EXPECT_VALID(result);
+    EXPECT_VALID(Dart_IntegerToInt64(result, &value));
+    EXPECT_EQ(i * 3 + 7, value);
+    Dart_ExitScope();
+  }
+
+  // Without arguments the previous ones are passed again.
+  Dart_Handle result = Dart_InvokeClosureInvocation(invocation, nullptr);
+  EXPECT_VALID(result);
+  EXPECT_VALID(Dart_IntegerToInt64(result, &value));
+  EXPECT_EQ(9 * 3 + 7, value);
+
+  // Argument types are still checked on every call.
+  Dart_Handle bad_args[2] = {Dart_EmptyString(), Dart_NewInteger(3)};
+  result = Dart_InvokeClosureInvocation(invocation, bad_args);
+  EXPECT_ERROR(result, "String' is not a subtype of type 'int' of 'i'");
+  Dart_DeleteClosureInvocation(invocation);
+
+  // Callable objects are resolved to their call method once.
+  Dart_Handle adder = Dart_Invoke(lib, NewString("makeAdder"), 0, nullptr);
+  EXPECT_VALID(adder);
+  EXPECT_VALID(Dart_NewClosureInvocation(adder, 2, &invocation));
+  Dart_Handle args[2] = {Dart_NewInteger(40), Dart_NewInteger(2)};
+  result = Dart_InvokeClosureInvocation(invocation, args);
+  EXPECT_VALID(result);
+  EXPECT_VALID(Dart_IntegerToInt64(result, &value));
+  EXPECT_EQ(42, value);
+  Dart_DeleteClosureInvocation(invocation);
+
+  // A wrong number of arguments ends in noSuchMethod, as with
+  // Dart_InvokeClosure.
+  EXPECT_VALID(Dart_NewClosureInvocation(closure, 1, &invocation));
+  result = Dart_InvokeClosureInvocation(invocation, dart_arguments);
+  EXPECT(Dart_IsError(result));
+  EXPECT(Dart_ErrorHasException(result));
+  Dart_DeleteClosureInvocation(invocation);
+}
+
 void ExceptionNative(Dart_NativeArguments args) {
   Dart_EnterScope();
   Dart_ThrowException(NewString("Hello from ExceptionNative!"));
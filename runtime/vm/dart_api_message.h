@@ -10,20 +10,21 @@
 #include "vm/allocation.h"
 #include "vm/dart_api_state.h"
 #include "vm/message.h"
+#include "vm/object.h"
 #include "vm/raw_object.h"
 #include "vm/snapshot.h"
 
 namespace dart {
 
-// This class handles translation of certain ObjectPtrs to CObjects for
-// NativeMessageHandlers.
-//
-// TODO(zra): Expand to support not only null, but also other VM heap objects
-// as well.
+// This class handles translation between CObjects and the ObjectPtrs which can
+// be sent in a message without serialization: Smis, null and booleans.
+// Messages carrying such values hold the raw ObjectPtr (see Message), in both
+// directions between Dart and NativeMessageHandlers.
 class ApiObjectConverter : public AllStatic {
  public:
   static bool CanConvert(const ObjectPtr raw_obj) {
-    return !raw_obj->IsHeapObject() || (raw_obj == Object::null());
+    return !raw_obj->IsHeapObject() || (raw_obj == Object::null()) ||
+           (raw_obj == Bool::True().ptr()) || (raw_obj == Bool::False().ptr());
   }
 
   static bool Convert(const ObjectPtr raw_obj, Dart_CObject* c_obj) {
@@ -31,17 +32,46 @@ class ApiObjectConverter : public AllStatic {
       ConvertSmi(static_cast<const SmiPtr>(raw_obj), c_obj);
     } else if (raw_obj == Object::null()) {
       ConvertNull(c_obj);
+    } else if (raw_obj == Bool::True().ptr()) {
+      ConvertBool(true, c_obj);
+    } else if (raw_obj == Bool::False().ptr()) {
+      ConvertBool(false, c_obj);
     } else {
       return false;
     }
     return true;
   }
 
+  // The inverse of Convert: returns true and sets |raw_obj| if |c_obj| is a
+  // value which can be sent without serialization.
+  static bool ConvertToRaw(const Dart_CObject* c_obj, ObjectPtr* raw_obj) {
+    switch (c_obj->type) {
+      case Dart_CObject_kNull:
+        *raw_obj = Object::null();
+        return true;
+      case Dart_CObject_kBool:
+        *raw_obj = Bool::Get(c_obj->value.as_bool).ptr();
+        return true;
+      case Dart_CObject_kInt32:
+        if (!Smi::IsValid(c_obj->value.as_int32)) return false;
+        *raw_obj = Smi::New(c_obj->value.as_int32);
+        return true;
+      case Dart_CObject_kInt64:
+        if (!Smi::IsValid(c_obj->value.as_int64)) return false;
+        *raw_obj = Smi::New(static_cast<intptr_t>(c_obj->value.as_int64));
+        return true;
+      default:
+        return false;
+    }
+  }
+
  private:
   static void ConvertSmi(const SmiPtr raw_smi, Dart_CObject* c_obj) {
     ASSERT(!raw_smi->IsHeapObject());
     intptr_t value = Smi::Value(raw_smi);
-    if (Utils::IsInt(31, value)) {
+    // Same split as the message deserializer, so the CObject type does not
+    // depend on whether the value was serialized.
+    if (Utils::IsInt(32, value)) {
       c_obj->type = Dart_CObject_kInt32;
       c_obj->value.as_int32 = static_cast<int32_t>(value);
     } else {
@@ -54,6 +84,11 @@ class ApiObjectConverter : public AllStatic {
     c_obj->type = Dart_CObject_kNull;
     c_obj->value.as_int64 = 0;
   }
+
+  static void ConvertBool(bool value, Dart_CObject* c_obj) {
+    c_obj->type = Dart_CObject_kBool;
+    c_obj->value.as_bool = value;
+  }
 };
 
 }  // namespace dart
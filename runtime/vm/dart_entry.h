@@ -240,9 +240,9 @@ class DartEntry : public AllStatic {
                                       const Array& arguments,
                                       const Array& arguments_descriptor);
 
- private:
   // Resolves the first argument in the provided arguments array to a callable
-  // compatible with the arguments. Helper method used within InvokeClosure.
+  // compatible with the arguments. Helper method used within InvokeClosure,
+  // and by Dart_NewClosureInvocation to resolve a closure once for many calls.
   //
   // If no errors occur, the first argument is changed to be either the resolved
   // callable or, if Function::null() is returned, an appropriate target for
@@ -255,7 +255,7 @@ class DartEntry : public AllStatic {
 
   // Invokes a function returned by ResolveCallable, performing any dynamic
   // checks needed if the function cannot receive dynamic invocation. Helper
-  // method used within InvokeClosure.
+  // method used within InvokeClosure and Dart_InvokeClosureInvocation.
   //
   // On success, returns an InstancePtr. On failure, an ErrorPtr.
   static ObjectPtr InvokeCallable(Thread* thread,
@@ -16,6 +16,57 @@ static constexpr char kExponentChar = 'e';
 static constexpr const char* kInfinitySymbol = "Infinity";
 static constexpr const char* kNaNSymbol = "NaN";
 
+// Largest integer n such that every integer in [0, n] is exactly
+// representable as a double.
+static constexpr uint64_t kMaxExactDoubleInteger = static_cast<uint64_t>(1)
+                                                   << 53;
+
+// Powers of ten that are exactly representable as doubles.
+static constexpr double kExactPowersOfTen[] = {
+    1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,  1e8,  1e9,  1e10, 1e11,
+    1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22,
+};
+static constexpr intptr_t kMaxExactPowerOfTen =
+    ARRAY_SIZE(kExactPowersOfTen) - 1;
+
+// Formats doubles which hold an integer value of magnitude below 2^53.
+//
+// Every integer in that range is exactly representable and its neighbours
+// are at least 1 apart, so the shortest representation which round-trips is
+// the integer itself. These are by far the most common doubles printed in
+// practice (counters, coordinates, timestamps) and do not need to go through
+// the general shortest-digits algorithm.
+static bool FastIntegralDoubleToCString(double d, char* buffer) {
+  if (!(-static_cast<double>(kMaxExactDoubleInteger) < d &&
+        d < static_cast<double>(kMaxExactDoubleInteger))) {
+    return false;  // Also rejects NaN.
+  }
+  const int64_t ival = static_cast<int64_t>(d);
+  if (static_cast<double>(ival) != d) {
+    return false;
+  }
+  char digits[20];
+  intptr_t num_digits = 0;
+  uint64_t magnitude = ival < 0 ? -ival : ival;
+  do {
+    digits[num_digits++] = '0' + (magnitude % 10);
+    magnitude /= 10;
+  } while (magnitude != 0);
+
+  intptr_t pos = 0;
+  // Check the sign bit rather than ival to print -0.0 correctly.
+  if (signbit(d)) {
+    buffer[pos++] = '-';
+  }
+  while (num_digits > 0) {
+    buffer[pos++] = digits[--num_digits];
+  }
+  buffer[pos++] = '.';
+  buffer[pos++] = '0';
+  buffer[pos] = '\0';
+  return true;
+}
+
 void DoubleToCString(double d, char* buffer, int buffer_size) {
   const int kDecimalLow = -6;
   const int kDecimalHigh = 21;
@@ -31,6 +82,10 @@ void DoubleToCString(double d, char* buffer, int buffer_size) {
   // sign, at most three exponent digits, plus the \0.
   ASSERT(buffer_size >= 1 + 17 + 1 + 1 + 1 + 3 + 1);
 
+  if (FastIntegralDoubleToCString(d, buffer)) {
+    return;
+  }
+
   const int kConversionFlags =
       double_conversion::DoubleToStringConverter::EMIT_POSITIVE_EXPONENT_SIGN |
       double_conversion::DoubleToStringConverter::EMIT_TRAILING_DECIMAL_POINT |
@@ -152,11 +207,101 @@ StringPtr DoubleToStringAsPrecision(double d, int precision) {
   return String::New(builder.Finalize());
 }
 
+// Parses simple decimal literals of the form [+-]digits[.digits][e[+-]digits]
+// whose value can be computed exactly with a single IEEE multiplication or
+// division (Clinger's fast path): the significand has at most 53 bits and the
+// decimal exponent is an exactly representable power of ten. Such a result is
+// correctly rounded. Returns false if the input does not qualify, in which case
+// the caller must use the general algorithm. Never rejects valid input on its
+// own.
+static bool FastCStringToDouble(const char* str,
+                                intptr_t length,
+                                double* result) {
+  const char* p = str;
+  const char* const end = str + length;
+  bool negative = false;
+  if (*p == '-' || *p == '+') {
+    negative = (*p == '-');
+    p++;
+  }
+
+  // Accumulate at most 19 significant digits, which always fit in a uint64_t.
+  const intptr_t kMaxSignificantDigits = 19;
+  uint64_t significand = 0;
+  intptr_t significant_digits = 0;
+  intptr_t exponent = 0;
+
+  const char* const int_start = p;
+  while (p < end && Utils::IsDecimalDigit(*p)) {
+    if (significand != 0 || *p != '0') {
+      if (significant_digits == kMaxSignificantDigits) return false;
+      significand = significand * 10 + (*p - '0');
+      significant_digits++;
+    }
+    p++;
+  }
+  if (p == int_start) return false;
+
+  if (p < end && *p == '.') {
+    p++;
+    const char* const fraction_start = p;
+    while (p < end && Utils::IsDecimalDigit(*p)) {
+      if (significand != 0 || *p != '0') {
+        if (significant_digits == kMaxSignificantDigits) return false;
+        significand = significand * 10 + (*p - '0');
+        significant_digits++;
+      }
+      exponent--;
+      p++;
+    }
+    if (p == fraction_start) return false;
+  }
+
+  if (p < end && (*p == 'e' || *p == 'E')) {
+    p++;
+    bool negative_exponent = false;
+    if (p < end && (*p == '-' || *p == '+')) {
+      negative_exponent = (*p == '-');
+      p++;
+    }
+    const char* const exponent_start = p;
+    intptr_t explicit_exponent = 0;
+    while (p < end && Utils::IsDecimalDigit(*p)) {
+      // Anything this large is far outside of the fast path range.
+      if (explicit_exponent >= 10000) return false;
+      explicit_exponent = explicit_exponent * 10 + (*p - '0');
+      p++;
+    }
+    if (p == exponent_start) return false;
+    exponent += negative_exponent ? -explicit_exponent : explicit_exponent;
+  }
+
+  if (p != end) return false;
+  if (significand > kMaxExactDoubleInteger) return false;
+
+  double value = static_cast<double>(significand);
+  if (significand == 0) {
+    // Zero with any exponent.
+  } else if (0 <= exponent && exponent <= kMaxExactPowerOfTen) {
+    value *= kExactPowersOfTen[exponent];
+  } else if (-kMaxExactPowerOfTen <= exponent && exponent < 0) {
+    value /= kExactPowersOfTen[-exponent];
+  } else {
+    return false;
+  }
+  *result = negative ? -value : value;
+  return true;
+}
+
 bool CStringToDouble(const char* str, intptr_t length, double* result) {
   if (length == 0) {
     return false;
   }
 
+  if (FastCStringToDouble(str, length, result)) {
+    return true;
+  }
+
   double_conversion::StringToDoubleConverter converter(
       double_conversion::StringToDoubleConverter::NO_FLAGS, 0.0, 0.0,
       kInfinitySymbol, kNaNSymbol);
@@ -0,0 +1,79 @@
+// Copyright (c) 2026, the Dart project authors.  Please see the AUTHORS file
+// for details. All rights reserved. Use of this source code is governed by a
+// BSD-style license that can be found in the LICENSE file.
+
+#include <limits>
+
+#include "vm/double_conversion.h"
+
+#include "platform/assert.h"
+#include "vm/unit_test.h"
+
+namespace dart {
+
+static const char* ToCString(double d) {
+  static char buffer[128];
+  DoubleToCString(d, buffer, sizeof(buffer));
+  return buffer;
+}
+
+VM_UNIT_TEST_CASE(DoubleToCString) {
+  // Integral values.
+  EXPECT_STREQ("0.0", ToCString(0.0));
+  EXPECT_STREQ("-0.0", ToCString(-0.0));
+  EXPECT_STREQ("1.0", ToCString(1.0));
+  EXPECT_STREQ("-42.0", ToCString(-42.0));
+  EXPECT_STREQ("9007199254740991.0", ToCString(9007199254740991.0));
+  EXPECT_STREQ("-9007199254740991.0", ToCString(-9007199254740991.0));
+  EXPECT_STREQ("9007199254740992.0", ToCString(9007199254740992.0));
+  EXPECT_STREQ("100000000000000000000.0", ToCString(1e20));
+  EXPECT_STREQ("1e+21", ToCString(1e21));
+
+  // Non-integral values.
+  EXPECT_STREQ("0.1", ToCString(0.1));
+  EXPECT_STREQ("-1.5", ToCString(-1.5));
+  EXPECT_STREQ("0.000001", ToCString(1e-6));
+  EXPECT_STREQ("1e-7", ToCString(1e-7));
+  EXPECT_STREQ("Infinity", ToCString(std::numeric_limits<double>::infinity()));
+  EXPECT_STREQ("NaN", ToCString(std::numeric_limits<double>::quiet_NaN()));
+}
+
+static void ExpectParses(const char* str, double expected) {
+  double result = 0.0;
+  EXPECT(CStringToDouble(str, strlen(str), &result));
+  EXPECT_EQ(bit_cast<uint64_t>(expected), bit_cast<uint64_t>(result));
+}
+
+static void ExpectDoesNotParse(const char* str) {
+  double result = 0.0;
+  EXPECT(!CStringToDouble(str, strlen(str), &result));
+}
+
+VM_UNIT_TEST_CASE(CStringToDouble) {
+  // Inputs handled by the exact fast path.
+  ExpectParses("0", 0.0);
+  ExpectParses("-0", -0.0);
+  ExpectParses("+1", 1.0);
+  ExpectParses("123.456", 123.456);
+  ExpectParses("-0.001", -0.001);
+  ExpectParses("1e22", 1e22);
+  ExpectParses("1E-22", 1e-22);
+  ExpectParses("12.5e+3", 12500.0);
+
+  // Inputs which need the general algorithm.
+  ExpectParses("0.0000000000000000000000000000001", 1e-31);
+  ExpectParses("9007199254740993", 9007199254740992.0);
+  ExpectParses("1e23", 1e23);
+  ExpectParses("2.2250738585072014e-308", 2.2250738585072014e-308);
+  ExpectParses("1.7976931348623157e308", 1.7976931348623157e308);
+  ExpectParses("123456789012345678901234567890", 1.2345678901234568e29);
+  ExpectParses("Infinity", std::numeric_limits<double>::infinity());
+  ExpectParses("-Infinity", -std::numeric_limits<double>::infinity());
+
+  ExpectDoesNotParse("1x");
+  ExpectDoesNotParse("e5");
+  ExpectDoesNotParse("1e");
+  ExpectDoesNotParse("--1");
+}
+
+}  // namespace dart
@@ -60,7 +60,11 @@ constexpr bool FLAG_support_il_printer = false;
   P(dwarf_stack_traces_mode, bool, false,                                      \
     "Use --[no-]dwarf-stack-traces instead.")                                  \
   R(dedup_instructions, true, bool, false,                                     \
-    "Canonicalize instructions when precompiling.")
+    "Canonicalize instructions when precompiling.")                            \
+  P(use_safepoint_poll_page, bool, false,                                      \
+    "Check for interrupts in optimized loops by loading from a page that is "  \
+    "protected while an interrupt is pending (Linux x64 only). Any SIGSEGV "   \
+    "handler of the embedder must be installed before Dart_Initialize.")
 
 // List of all flags in the VM.
 // Flags can be one of four categories:
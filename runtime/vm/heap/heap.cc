@@ -109,6 +109,9 @@ uword Heap::AllocateNew(Thread* thread, intptr_t size) {
 
 uword Heap::AllocateOld(Thread* thread, intptr_t size, bool is_exec) {
   ASSERT(thread->no_safepoint_scope_depth() == 0);
+  // Old space has no TLABs, so charge the allocation here rather than in
+  // Page::Release. This includes large objects.
+  thread->AccountAllocatedBytes(size);
 
 #if !defined(PRODUCT) || defined(FORCE_INCLUDE_SAMPLING_HEAP_PROFILER)
   if (HeapProfileSampler::enabled()) {
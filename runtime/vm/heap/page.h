@@ -235,6 +235,7 @@ class Page {
     thread->heap_sampler().HandleReleasedTLAB(Thread::Current());
 #endif
     ASSERT(new_top >= old_top);
+    thread->AccountAllocatedBytes(new_top - old_top);
     return new_top - old_top;
   }
   void Release() {
@@ -5,14 +5,54 @@
 #include "vm/heap/safepoint.h"
 
 #include "vm/heap/heap.h"
+#include "vm/json_stream.h"
+#include "vm/os.h"
+#include "vm/tags.h"
 #include "vm/thread.h"
 #include "vm/thread_barrier.h"
 #include "vm/thread_registry.h"
+#include "vm/timeline.h"
 
 namespace dart {
 
 DEFINE_FLAG(bool, trace_safepoint, false, "Trace Safepoint logic.");
 
+#if !defined(PRODUCT)
+static const char* SafepointLevelToString(SafepointLevel level) {
+  switch (level) {
+    case SafepointLevel::kGC:
+      return "GC";
+    case SafepointLevel::kGCAndDeopt:
+      return "GCAndDeopt";
+    case SafepointLevel::kGCAndDeoptAndReload:
+      return "GCAndDeoptAndReload";
+    default:
+      UNREACHABLE();
+      return nullptr;
+  }
+}
+
+static const char* StragglerTagName(uword vm_tag) {
+  // Helper threads that never ran Dart code have no tag.
+  return vm_tag == VMTag::kInvalidTagId ? "Unknown" : VMTag::TagName(vm_tag);
+}
+
+void TimeToSafepointStats::Add(int64_t micros, const Straggler& straggler) {
+  intptr_t bucket = 0;
+  while ((bucket < kNumBuckets - 1) && (micros >= (int64_t{1} << bucket))) {
+    bucket++;
+  }
+  buckets[bucket]++;
+  count++;
+  total_micros += micros;
+  last = straggler;
+  if (micros >= max_micros) {
+    max_micros = micros;
+    slowest = straggler;
+  }
+}
+#endif  // !defined(PRODUCT)
+
 SafepointOperationScope::SafepointOperationScope(Thread* T,
                                                  SafepointLevel level)
     : ThreadStackResource(T), level_(level) {
@@ -84,6 +124,9 @@ void SafepointHandler::SafepointThreads(Thread* T, SafepointLevel level) {
   ASSERT(T->current_safepoint_level() >= level);
 
   MallocGrowableArray<Dart_Port> oob_isolates;
+#if !defined(PRODUCT)
+  int64_t start_micros = 0;
+#endif
   {
     MonitorLocker tl(threads_lock());
 
@@ -120,6 +163,9 @@ void SafepointHandler::SafepointThreads(Thread* T, SafepointLevel level) {
     }
     handlers_[level]->SetSafepointInProgress(T);
 
+#if !defined(PRODUCT)
+    start_micros = OS::GetCurrentMonotonicMicros();
+#endif
     // Ensure a thread is at a safepoint or notify it to get to one.
     handlers_[level]->NotifyThreadsToGetToSafepointLevel(T, &oob_isolates);
   }
@@ -130,7 +176,28 @@ void SafepointHandler::SafepointThreads(Thread* T, SafepointLevel level) {
   }
 
   // Now wait for all threads that are not already at a safepoint to check-in.
-  handlers_[level]->WaitUntilThreadsReachedSafepointLevel();
+  {
+#if defined(SUPPORT_TIMELINE)
+    TimelineBeginEndScope tbes(T, Timeline::GetGCStream(), "WaitForSafepoint");
+#endif
+    handlers_[level]->WaitUntilThreadsReachedSafepointLevel();
+#if !defined(PRODUCT)
+    TimeToSafepointStats::Straggler straggler;
+    const bool has_straggler = handlers_[level]->RecordTimeToSafepoint(
+        OS::GetCurrentMonotonicMicros() - start_micros, &straggler);
+#if defined(SUPPORT_TIMELINE)
+    if (tbes.enabled()) {
+      tbes.SetNumArguments(has_straggler ? 3 : 1);
+      tbes.CopyArgument(0, "level", SafepointLevelToString(level));
+      if (has_straggler) {
+        tbes.CopyArgument(1, "lastThread", straggler.name);
+        tbes.CopyArgument(2, "lastThreadTag",
+                          StragglerTagName(straggler.vm_tag));
+      }
+    }
+#endif  // defined(SUPPORT_TIMELINE)
+#endif  // !defined(PRODUCT)
+  }
 
   // No other mutator is running at this point. We'll set ourselves as owners of
   // all the lower levels as well - since higher levels provide even more
@@ -165,6 +232,12 @@ void SafepointHandler::LevelHandler::NotifyThreadsToGetToSafepointLevel(
     Thread* T,
     MallocGrowableArray<Dart_Port>* oob_isolates) {
   ASSERT(num_threads_not_parked_ == 0);
+#if !defined(PRODUCT)
+  {
+    MonitorLocker sl(&parked_lock_);
+    has_straggler_ = false;
+  }
+#endif
   for (auto current = isolate_group()->thread_registry()->active_list();
        current != nullptr; current = current->next()) {
     MonitorLocker tl(current->thread_lock());
@@ -354,10 +427,76 @@ void SafepointHandler::LevelHandler::NotifyWeAreParked(Thread* T) {
   ASSERT(num_threads_not_parked_ > 0);
   num_threads_not_parked_ -= 1;
   if (num_threads_not_parked_ == 0) {
+#if !defined(PRODUCT)
+    // Remember who held up the operation. The tag names the native function
+    // or runtime entry the thread was in when it checked in.
+    const char* name =
+        T->os_thread() != nullptr ? T->os_thread()->name() : nullptr;
+    Utils::SNPrint(straggler_.name, TimeToSafepointStats::kMaxThreadNameLength,
+                   "%s", name != nullptr ? name : "<unnamed>");
+    straggler_.vm_tag = T->vm_tag();
+    has_straggler_ = true;
+#endif
     sl.Notify();
   }
 }
 
+#if !defined(PRODUCT)
+bool SafepointHandler::LevelHandler::RecordTimeToSafepoint(
+    int64_t micros,
+    TimeToSafepointStats::Straggler* straggler) {
+  MonitorLocker sl(&parked_lock_);
+  // Operations which found every other thread already at a safepoint did not
+  // wait, and would only pile up in the first bucket.
+  if (!has_straggler_) return false;
+  stats_.Add(micros, straggler_);
+  *straggler = straggler_;
+  return true;
+}
+
+TimeToSafepointStats SafepointHandler::TimeToSafepointStatsAt(
+    SafepointLevel level) {
+  LevelHandler* handler = handlers_[level];
+  MonitorLocker sl(&handler->parked_lock_);
+  return handler->stats_;
+}
+
+static void PrintStraggler(JSONObject* jsobj,
+                           const char* name,
+                           const TimeToSafepointStats::Straggler& straggler) {
+  if (straggler.name[0] == '\0') return;
+  JSONObject thread(jsobj, name);
+  thread.AddProperty("name", straggler.name);
+  thread.AddProperty("vmTag", StragglerTagName(straggler.vm_tag));
+}
+
+void SafepointHandler::PrintTimeToSafepointJSON(JSONStream* stream) {
+  JSONObject jsobj(stream);
+  jsobj.AddProperty("type", "_TimeToSafepoint");
+  JSONArray levels(&jsobj, "levels");
+  for (intptr_t level = 0; level < SafepointLevel::kNumLevels; ++level) {
+    const TimeToSafepointStats stats =
+        TimeToSafepointStatsAt(static_cast<SafepointLevel>(level));
+    JSONObject entry(&levels);
+    entry.AddProperty("level",
+                      SafepointLevelToString(static_cast<SafepointLevel>(level)));
+    entry.AddProperty64("count", stats.count);
+    entry.AddProperty64("totalMicros", stats.total_micros);
+    entry.AddProperty64("maxMicros", stats.max_micros);
+    {
+      // Entry i counts operations that took less than 2^i microseconds (and
+      // at least 2^(i-1)).
+      JSONArray buckets(&entry, "log2Buckets");
+      for (intptr_t i = 0; i < TimeToSafepointStats::kNumBuckets; ++i) {
+        buckets.AddValue64(stats.buckets[i]);
+      }
+    }
+    PrintStraggler(&entry, "lastThread", stats.last);
+    PrintStraggler(&entry, "slowestThread", stats.slowest);
+  }
+}
+#endif  // !defined(PRODUCT)
+
 void SafepointHandler::ExitSafepointLocked(Thread* T,
                                            MonitorLocker* tl,
                                            SafepointLevel level) {
@@ -14,8 +14,37 @@
 
 namespace dart {
 
+class JSONStream;
 class ThreadBarrier;
 
+#if !defined(PRODUCT)
+// Time it took to bring all threads to a safepoint, for the safepoint
+// operations of one level which had to wait for at least one thread.
+struct TimeToSafepointStats {
+  // buckets[0] counts operations that took less than 1us, buckets[i] those
+  // that took [2^(i-1), 2^i) us. The last bucket also holds everything slower.
+  static constexpr intptr_t kNumBuckets = 24;
+  static constexpr intptr_t kMaxThreadNameLength = 64;
+
+  // The thread whose check-in completed an operation.
+  struct Straggler {
+    char name[kMaxThreadNameLength] = {};
+    uword vm_tag = 0;
+  };
+
+  void Add(int64_t micros, const Straggler& straggler);
+
+  int64_t count = 0;
+  int64_t total_micros = 0;
+  int64_t max_micros = 0;
+  int64_t buckets[kNumBuckets] = {};
+  // The last thread to check in, for the most recent and the slowest
+  // operation respectively.
+  Straggler last;
+  Straggler slowest;
+};
+#endif  // !defined(PRODUCT)
+
 // A stack based scope that can be used to perform an operation after getting
 // all threads to a safepoint. At the end of the operation all the threads are
 // resumed.
@@ -144,6 +173,11 @@ class SafepointHandler {
 
   void RunTasks(IntrusiveDList<SafepointTask>* tasks);
 
+#if !defined(PRODUCT)
+  TimeToSafepointStats TimeToSafepointStatsAt(SafepointLevel level);
+  void PrintTimeToSafepointJSON(JSONStream* stream);
+#endif
+
  private:
   class LevelHandler {
    public:
@@ -185,6 +219,12 @@ class SafepointHandler {
         Thread* T,
         MallocGrowableArray<Dart_Port>* oob_isolates);
     void WaitUntilThreadsReachedSafepointLevel();
+#if !defined(PRODUCT)
+    // Records the time it took the last thread to check in, if any thread
+    // was waited for, and returns that thread.
+    bool RecordTimeToSafepoint(int64_t micros,
+                               TimeToSafepointStats::Straggler* straggler);
+#endif
 
     // Helper methods for [ResumeThreads]
     void NotifyThreadsToContinue(Thread* T);
@@ -207,6 +247,13 @@ class SafepointHandler {
     // Count the number of threads the currently in-progress safepoint operation
     // is waiting for to check-in.
     int32_t num_threads_not_parked_ = 0;
+
+#if !defined(PRODUCT)
+    // Protected by [parked_lock_].
+    TimeToSafepointStats::Straggler straggler_;
+    bool has_straggler_ = false;
+    TimeToSafepointStats stats_;
+#endif
   };
 
   void SafepointThreads(Thread* T, SafepointLevel level);
@@ -612,6 +612,84 @@ ISOLATE_UNIT_TEST_CASE(SafepointOperation_StressTest) {
   thread->ExitSafepoint();
 }
 
+#if !defined(PRODUCT)
+// Polls for safepoint requests the way a Dart loop with interrupt checks
+// would.
+class PollingTask : public StateMachineTask {
+ public:
+  explicit PollingTask(std::shared_ptr<Data> data) : StateMachineTask(data) {}
+
+ protected:
+  virtual void RunInternal() {
+    while (!data_->IsIn(kPleaseExit)) {
+      if (thread_->IsSafepointRequested()) {
+        thread_->BlockForSafepoint();
+      }
+      OS::SleepMicros(10);
+    }
+  }
+};
+
+ISOLATE_UNIT_TEST_CASE(SafepointOperation_TimeToSafepointStats) {
+  auto isolate_group = thread->isolate_group();
+  auto safepoint_handler = isolate_group->safepoint_handler();
+
+  const intptr_t kTaskCount = 4;
+  const intptr_t kOperationCount = 200;
+
+  std::vector<std::shared_ptr<PollingTask::Data>> threads;
+  for (intptr_t i = 0; i < kTaskCount; ++i) {
+    threads.push_back(std::make_shared<PollingTask::Data>(isolate_group));
+  }
+
+  const TimeToSafepointStats before =
+      safepoint_handler->TimeToSafepointStatsAt(SafepointLevel::kGC);
+  {
+    // Will join outstanding threads on destruction.
+    ThreadPool pool;
+
+    for (intptr_t i = 0; i < kTaskCount; i++) {
+      pool.Run<PollingTask>(threads[i]);
+    }
+    for (intptr_t i = 0; i < kTaskCount; i++) {
+      threads[i]->WaitUntil(PollingTask::kEntered);
+    }
+    for (intptr_t i = 0; i < kOperationCount; i++) {
+      GcSafepointOperationScope safepoint_op(thread);
+    }
+    for (intptr_t i = 0; i < kTaskCount; i++) {
+      threads[i]->MarkAndNotify(PollingTask::kPleaseExit);
+    }
+    for (intptr_t i = 0; i < kTaskCount; i++) {
+      threads[i]->WaitUntil(PollingTask::kExited);
+    }
+  }
+  const TimeToSafepointStats after =
+      safepoint_handler->TimeToSafepointStatsAt(SafepointLevel::kGC);
+
+  // Only operations which had to wait for a thread are recorded. The first
+  // one found all polling threads running. Later ones may find them still
+  // parked from the previous operation.
+  EXPECT_LE(1, after.count - before.count);
+  EXPECT_LE(after.count - before.count, kOperationCount);
+  EXPECT_NE('\0', after.last.name[0]);
+  EXPECT_NE('\0', after.slowest.name[0]);
+
+  int64_t histogram_count = 0;
+  intptr_t highest_bucket = 0;
+  for (intptr_t i = 0; i < TimeToSafepointStats::kNumBuckets; i++) {
+    histogram_count += after.buckets[i];
+    if (after.buckets[i] != 0) highest_bucket = i;
+  }
+  EXPECT_EQ(after.count, histogram_count);
+  EXPECT_LE(after.max_micros, after.total_micros);
+  // The slowest operation is in the highest non-empty bucket.
+  TimeToSafepointStats max_only;
+  max_only.Add(after.max_micros, after.slowest);
+  EXPECT_EQ(1, max_only.buckets[highest_bucket]);
+}
+#endif  // !defined(PRODUCT)
+
 ISOLATE_UNIT_TEST_CASE(SafepointOperation_DeoptAndNonDeoptNesting) {
   auto safepoint_handler = thread->isolate_group()->safepoint_handler();
   {
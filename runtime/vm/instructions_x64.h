@@ -145,6 +145,34 @@ class PcRelativeCallPattern : public InstructionPattern<PcRelativeCallPattern> {
   static int pattern_length_in_bytes() { return kLengthInBytes; }
 };
 
+// Loop interrupt check emitted by Assembler::SafepointPoll:
+//
+//   test [r11], r11d          45 85 1b
+//   nop [rax + disp32]        0f 1f 80 <disp32>
+//
+// r11 holds Thread::safepoint_poll_page_, so the load faults while an
+// interrupt is pending. disp32 is the offset of the slow path from the end of
+// the nop.
+class SafepointPollPattern : public InstructionPattern<SafepointPollPattern> {
+ public:
+  static constexpr int kLengthInBytes = 10;
+
+  explicit SafepointPollPattern(uword pc) : InstructionPattern(pc) {}
+
+  uword slow_path() const {
+    return start() + kLengthInBytes +
+           LoadUnaligned(reinterpret_cast<int32_t*>(start() + 6));
+  }
+
+  static const int* pattern() {
+    static const int kPattern[kLengthInBytes] = {0x45, 0x85, 0x1b, 0x0f, 0x1f,
+                                                 0x80, -1,   -1,   -1,   -1};
+    return kPattern;
+  }
+
+  static int pattern_length_in_bytes() { return kLengthInBytes; }
+};
+
 // Instruction pattern for a tail call to a signed 32-bit PC-relative offset
 //
 // The AOT compiler can emit PC-relative calls. If the destination of such a
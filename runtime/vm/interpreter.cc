@@ -40,6 +40,11 @@ DEFINE_FLAG(uint64_t,
             interpreter_trace_file_max_bytes,
             100 * MB,
             "Maximum size in bytes of the interpreter trace file");
+DEFINE_FLAG(bool,
+            interpreter_print_bytecode_pairs,
+            false,
+            "Print the most frequently executed pairs of adjacent bytecodes "
+            "when the interpreter exits (debug mode only).");
 
 // InterpreterSetjmpBuffer are linked together, and the last created one
 // is referenced by the Interpreter. When an exception is thrown, the exception
@@ -337,13 +342,48 @@ void LookupCache::Insert(intptr_t receiver_cid,
   entries_[probe1].target = target;
 }
 
+void CallSiteCache::Clear() {
+  for (intptr_t i = 0; i < kNumEntries; i++) {
+    entries_[i].pc = nullptr;
+  }
+}
+
+bool CallSiteCache::Insert(const KBCInstr* pc,
+                           intptr_t receiver_cid,
+                           FunctionPtr target) {
+  // Otherwise we have to clear the cache on scavenges too.
+  ASSERT(target->IsOldObject());
+  ASSERT(receiver_cid != kIllegalCid);
+
+  Entry& entry = entries_[IndexOf(pc)];
+  if (entry.pc != pc) {
+    // Evict the call site sharing this entry, if any.
+    const bool was_free = entry.pc == nullptr;
+    entry.pc = pc;
+    entry.receiver_cids[0] = receiver_cid;
+    entry.targets[0] = target;
+    for (intptr_t i = 1; i < kNumChecks; i++) {
+      entry.receiver_cids[i] = kIllegalCid;
+    }
+    return was_free;
+  }
+  for (intptr_t i = 0; i < kNumChecks; i++) {
+    if (entry.receiver_cids[i] == kIllegalCid) {
+      entry.receiver_cids[i] = receiver_cid;
+      entry.targets[i] = target;
+      return true;
+    }
+  }
+  return false;
+}
+
 Interpreter::Interpreter()
     : stack_(nullptr),
       fp_(nullptr),
       pp_(ObjectPool::null()),
       argdesc_(Array::null()),
       subtype_test_cache_(SubtypeTestCache::null()),
-      lookup_cache_() {
+      instance_call_cache_() {
   // Setup interpreter support first. Some of this information is needed to
   // setup the architecture state.
   // We allocate the stack here, the size is computed as the sum of
@@ -379,6 +419,12 @@ Interpreter::Interpreter()
       trace_buffer_idx_ = 0;
     }
   }
+  bytecode_pair_counts_ = nullptr;
+  previous_op_ = 0;
+  if (FLAG_interpreter_print_bytecode_pairs) {
+    bytecode_pair_counts_ =
+        new uint64_t[kNumOpcodeValues * kNumOpcodeValues]();
+  }
 #endif
 }
 
@@ -399,6 +445,11 @@ Interpreter::~Interpreter() {
       trace_buffer_ = nullptr;
     }
   }
+  if (bytecode_pair_counts_ != nullptr) {
+    PrintBytecodePairs();
+    delete[] bytecode_pair_counts_;
+    bytecode_pair_counts_ = nullptr;
+  }
 #endif
 }
 
@@ -438,6 +489,37 @@ DART_FORCE_INLINE bool Interpreter::IsWritingTraceFile() const {
          (trace_file_bytes_written_ < FLAG_interpreter_trace_file_max_bytes);
 }
 
+void Interpreter::PrintBytecodePairs() const {
+  struct PairCount {
+    intptr_t pair;
+    uint64_t count;
+  };
+  MallocGrowableArray<PairCount> pairs;
+  uint64_t total = 0;
+  for (intptr_t i = 0; i < kNumOpcodeValues * kNumOpcodeValues; i++) {
+    if (bytecode_pair_counts_[i] != 0) {
+      pairs.Add({i, bytecode_pair_counts_[i]});
+      total += bytecode_pair_counts_[i];
+    }
+  }
+  pairs.Sort([](const PairCount* a, const PairCount* b) {
+    if (a->count != b->count) return a->count > b->count ? -1 : 1;
+    return a->pair < b->pair ? -1 : (a->pair > b->pair ? 1 : 0);
+  });
+  const intptr_t kMaxPairsPrinted = 50;
+  OS::PrintErr("Most frequent bytecode pairs (%" Pu64 " pairs executed):\n",
+               total);
+  for (intptr_t i = 0; i < pairs.length() && i < kMaxPairsPrinted; i++) {
+    const auto first = static_cast<KernelBytecode::Opcode>(
+        pairs[i].pair >> kBitsPerByte);
+    const auto second = static_cast<KernelBytecode::Opcode>(
+        pairs[i].pair & (kNumOpcodeValues - 1));
+    OS::PrintErr("%12" Pu64 " %5.2f%% %s %s\n", pairs[i].count,
+                 100.0 * pairs[i].count / total, KernelBytecode::NameOf(first),
+                 KernelBytecode::NameOf(second));
+  }
+}
+
 void Interpreter::FlushTraceBuffer() {
   Dart_FileWriteCallback file_write = Dart::file_write_callback();
   if (file_write == nullptr) {
@@ -730,8 +812,8 @@ DART_FORCE_INLINE bool Interpreter::InstanceCall(Thread* thread,
   intptr_t receiver_cid = call_base[receiver_idx]->GetClassId();
 
   FunctionPtr target;
-  if (UNLIKELY(!lookup_cache_.Lookup(receiver_cid, target_name, argdesc_,
-                                     &target))) {
+  if (UNLIKELY(!instance_call_cache_.Lookup(*pc, receiver_cid, target_name,
+                                            argdesc_, &target))) {
     // Table lookup miss.
     top[0] = null_value;  // Clean up slot as it may be visited by GC.
     top[1] = call_base[receiver_idx];
@@ -750,10 +832,13 @@ DART_FORCE_INLINE bool Interpreter::InstanceCall(Thread* thread,
     target = static_cast<FunctionPtr>(top[4]);
     target_name = static_cast<StringPtr>(top[2]);
     argdesc_ = static_cast<ArrayPtr>(top[3]);
+    if (target != Function::null()) {
+      instance_call_cache_.Insert(*pc, receiver_cid, target_name, argdesc_,
+                                  target);
+    }
   }
 
   if (target != Function::null()) {
-    lookup_cache_.Insert(receiver_cid, target_name, argdesc_, target);
     top[0] = target;
     return Invoke(thread, call_base, top, pc, FP, SP);
   }
@@ -822,6 +907,9 @@ DART_FORCE_INLINE bool Interpreter::InstanceCall(Thread* thread,
   if (IsWritingTraceFile()) {                                                  \
     WriteInstructionToTrace(pc);                                               \
   }                                                                            \
+  if (bytecode_pair_counts_ != nullptr) {                                      \
+    CountBytecodePair(op);                                                     \
+  }                                                                            \
   icount_++;
 #else
 #define TRACE_INSTRUCTION
@@ -2964,6 +3052,21 @@ SwitchDispatch:
     DISPATCH();
   }
 
+  {
+    BYTECODE(JumpIfIntGe, T);
+
+    // Fused CompareIntLt and JumpIfFalse. Leaves the stack in the same state
+    // as CompareIntLt when throwing on a null operand.
+    SP -= 1;
+    UNBOX_INT64(a, SP[0], Symbols::LAngleBracket());
+    UNBOX_INT64(b, SP[1], Symbols::LAngleBracket());
+    SP -= 1;
+    if (a >= b) {
+      LOAD_JUMP_TARGET();
+    }
+    DISPATCH();
+  }
+
   {
     BYTECODE(CompareIntGe, 0);
 
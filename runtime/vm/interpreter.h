@@ -54,6 +54,104 @@ class LookupCache : public ValueObject {
   Entry entries_[kNumEntries];
 };
 
+// Inline caches for instance calls, keyed by call site. Each call site gets
+// up to kNumChecks (receiver cid, target) pairs; call sites which see more
+// receiver classes are megamorphic and fall back to the LookupCache (see
+// InstanceCallCache).
+//
+// A call site is identified by its bytecode pc, which also determines the
+// selector and arguments descriptor, so neither needs to be checked on a
+// hit. Like the LookupCache, this cache holds raw pointers to old-space
+// objects and must be cleared before objects can move or die.
+class CallSiteCache : public ValueObject {
+ public:
+  static const intptr_t kNumChecks = 2;
+
+  CallSiteCache() {
+    ASSERT(Utils::IsPowerOfTwo(kNumEntries));
+    Clear();
+  }
+
+  void Clear();
+
+  DART_FORCE_INLINE bool Lookup(const KBCInstr* pc,
+                                intptr_t receiver_cid,
+                                FunctionPtr* target) const {
+    const Entry& entry = entries_[IndexOf(pc)];
+    if (entry.pc != pc) return false;
+    for (intptr_t i = 0; i < kNumChecks; i++) {
+      if (entry.receiver_cids[i] == receiver_cid) {
+        *target = entry.targets[i];
+        return true;
+      }
+    }
+    return false;
+  }
+
+  // Returns false if the call site already has kNumChecks entries, i.e. it
+  // is megamorphic, or if it took over the entry of another call site.
+  bool Insert(const KBCInstr* pc, intptr_t receiver_cid, FunctionPtr target);
+
+ private:
+  struct Entry {
+    const KBCInstr* pc;
+    intptr_t receiver_cids[kNumChecks];
+    FunctionPtr targets[kNumChecks];
+  };
+
+  static const intptr_t kNumEntries = 1024;
+  static const intptr_t kTableMask = kNumEntries - 1;
+
+  static intptr_t IndexOf(const KBCInstr* pc) {
+    const uword address = reinterpret_cast<uword>(pc);
+    return (address ^ (address >> 10)) & kTableMask;
+  }
+
+  Entry entries_[kNumEntries];
+};
+
+// The caches consulted by interpreted instance calls before calling into the
+// runtime. Only call sites which the CallSiteCache cannot hold go to the
+// shared LookupCache, so that monomorphic and polymorphic sites do not evict
+// each other there.
+class InstanceCallCache : public ValueObject {
+ public:
+  InstanceCallCache() : call_sites_(), lookup_() {}
+
+  void Clear() {
+    call_sites_.Clear();
+    lookup_.Clear();
+  }
+
+  DART_FORCE_INLINE bool Lookup(const KBCInstr* pc,
+                                intptr_t receiver_cid,
+                                StringPtr function_name,
+                                ArrayPtr arguments_descriptor,
+                                FunctionPtr* target) const {
+    return call_sites_.Lookup(pc, receiver_cid, target) ||
+           lookup_.Lookup(receiver_cid, function_name, arguments_descriptor,
+                          target);
+  }
+
+  void Insert(const KBCInstr* pc,
+              intptr_t receiver_cid,
+              StringPtr function_name,
+              ArrayPtr arguments_descriptor,
+              FunctionPtr target) {
+    // A call site which evicts another one from the CallSiteCache is also
+    // recorded in the LookupCache. Otherwise two sites sharing an entry
+    // would keep evicting each other and miss on every call.
+    if (!call_sites_.Insert(pc, receiver_cid, target)) {
+      lookup_.Insert(receiver_cid, function_name, arguments_descriptor,
+                     target);
+    }
+  }
+
+ private:
+  CallSiteCache call_sites_;
+  LookupCache lookup_;
+};
+
 class Interpreter {
  public:
   static const uword kInterpreterStackUnderflowSize = 0x80;
@@ -117,7 +215,7 @@ class Interpreter {
   void Unexit(Thread* thread);
 
   void VisitObjectPointers(ObjectPointerVisitor* visitor);
-  void ClearLookupCache() { lookup_cache_.Clear(); }
+  void ClearLookupCache() { instance_call_cache_.Clear(); }
 
 #ifndef PRODUCT
   void set_is_debugging(bool value) { is_debugging_ = value; }
@@ -148,7 +246,7 @@ class Interpreter {
   SubtypeTestCachePtr subtype_test_cache_;
   ObjectPtr special_[KernelBytecode::kSpecialIndexCount];
 
-  LookupCache lookup_cache_;
+  InstanceCallCache instance_call_cache_;
 
   void Exit(Thread* thread,
             ObjectPtr* base,
@@ -274,6 +372,18 @@ class Interpreter {
       kTraceBufferSizeInBytes / sizeof(KBCInstr);
   KBCInstr* trace_buffer_;
   intptr_t trace_buffer_idx_;
+
+  // Dynamic counts of adjacent opcode pairs, used to find candidate
+  // superinstructions. Indexed by (previous opcode << 8) | opcode.
+  void CountBytecodePair(KBCInstr op) {
+    bytecode_pair_counts_[(previous_op_ << kBitsPerByte) | op]++;
+    previous_op_ = op;
+  }
+  void PrintBytecodePairs() const;
+
+  static const intptr_t kNumOpcodeValues = 1 << kBitsPerByte;
+  uint64_t* bytecode_pair_counts_;
+  KBCInstr previous_op_;
 #endif  // defined(DEBUG)
 
   // Longjmp support for exceptions.
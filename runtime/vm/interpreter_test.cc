@@ -0,0 +1,190 @@
+// Copyright (c) 2026, the Dart project authors.  Please see the AUTHORS file
+// for details. All rights reserved. Use of this source code is governed by a
+// BSD-style license that can be found in the LICENSE file.
+
+#include "vm/globals.h"
+#if defined(DART_DYNAMIC_MODULES)
+
+#include "vm/dart_entry.h"
+#include "vm/interpreter.h"
+#include "vm/symbols.h"
+#include "vm/unit_test.h"
+
+namespace dart {
+
+static FunctionPtr CreateFunction(const char* name) {
+  Thread* thread = Thread::Current();
+  const String& class_name = String::Handle(Symbols::New(thread, "ownerClass"));
+  const Class& owner_class = Class::Handle(Class::New(
+      Library::Handle(), class_name, Script::Handle(), TokenPosition::kNoSource));
+  const String& function_name = String::Handle(Symbols::New(thread, name));
+  const FunctionType& signature = FunctionType::Handle(FunctionType::New());
+  return Function::New(signature, function_name,
+                       UntaggedFunction::kRegularFunction, true, false, false,
+                       false, false, owner_class, TokenPosition::kNoSource);
+}
+
+ISOLATE_UNIT_TEST_CASE(InstanceCallCache_CollidingCallSites) {
+  const Function& target1 = Function::Handle(CreateFunction("target1"));
+  const Function& target2 = Function::Handle(CreateFunction("target2"));
+  const String& name1 = String::Handle(Symbols::New(thread, "name1"));
+  const String& name2 = String::Handle(Symbols::New(thread, "name2"));
+  const Array& args_descriptor =
+      Array::Handle(ArgumentsDescriptor::NewBoxed(0, 1));
+  // The pcs are never dereferenced. They only differ in bits which the
+  // CallSiteCache does not hash, so both call sites share an entry.
+  const KBCInstr* pc1 = reinterpret_cast<const KBCInstr*>(0x10000);
+  const KBCInstr* pc2 = reinterpret_cast<const KBCInstr*>(0x10000 + (1 << 20));
+  const intptr_t cid = kSmiCid;
+
+  InstanceCallCache cache;
+  FunctionPtr target;
+  EXPECT(!cache.Lookup(pc1, cid, name1.ptr(), args_descriptor.ptr(), &target));
+  cache.Insert(pc1, cid, name1.ptr(), args_descriptor.ptr(), target1.ptr());
+  EXPECT(cache.Lookup(pc1, cid, name1.ptr(), args_descriptor.ptr(), &target));
+  EXPECT(target == target1.ptr());
+
+  // The second site evicts the first one from the CallSiteCache.
+  EXPECT(!cache.Lookup(pc2, cid, name2.ptr(), args_descriptor.ptr(), &target));
+  cache.Insert(pc2, cid, name2.ptr(), args_descriptor.ptr(), target2.ptr());
+  EXPECT(!cache.Lookup(pc1, cid, name1.ptr(), args_descriptor.ptr(), &target));
+  cache.Insert(pc1, cid, name1.ptr(), args_descriptor.ptr(), target1.ptr());
+
+  // Once both sites went through a miss, calls alternating between them hit.
+  for (intptr_t i = 0; i < 4; i++) {
+    EXPECT(
+        cache.Lookup(pc1, cid, name1.ptr(), args_descriptor.ptr(), &target));
+    EXPECT(target == target1.ptr());
+    EXPECT(
+        cache.Lookup(pc2, cid, name2.ptr(), args_descriptor.ptr(), &target));
+    EXPECT(target == target2.ptr());
+  }
+
+  cache.Clear();
+  EXPECT(!cache.Lookup(pc1, cid, name1.ptr(), args_descriptor.ptr(), &target));
+  EXPECT(!cache.Lookup(pc2, cid, name2.ptr(), args_descriptor.ptr(), &target));
+}
+
+ISOLATE_UNIT_TEST_CASE(InstanceCallCache_MegamorphicCallSite) {
+  const Function& target = Function::Handle(CreateFunction("target"));
+  const String& name = String::Handle(Symbols::New(thread, "name"));
+  const Array& args_descriptor =
+      Array::Handle(ArgumentsDescriptor::NewBoxed(0, 1));
+  const KBCInstr* pc = reinterpret_cast<const KBCInstr*>(0x10000);
+  const intptr_t cids[] = {kSmiCid, kMintCid, kDoubleCid, kOneByteStringCid};
+
+  InstanceCallCache cache;
+  for (intptr_t cid : cids) {
+    cache.Insert(pc, cid, name.ptr(), args_descriptor.ptr(), target.ptr());
+  }
+  // Receiver classes beyond CallSiteCache::kNumChecks go to the LookupCache.
+  FunctionPtr result;
+  for (intptr_t cid : cids) {
+    EXPECT(cache.Lookup(pc, cid, name.ptr(), args_descriptor.ptr(), &result));
+    EXPECT(result == target.ptr());
+  }
+}
+
+// Returns 1 if the first argument is less than the second one and 0
+// otherwise. Parameters live below the fixed part of the frame, so with two
+// arguments they are FP[-6] and FP[-5].
+static const KBCInstr kJumpIfIntGeInstructions[] = {
+    KernelBytecode::kEntry,
+    0,
+    KernelBytecode::kPush,
+    static_cast<KBCInstr>(-6),
+    KernelBytecode::kPush,
+    static_cast<KBCInstr>(-5),
+    KernelBytecode::kJumpIfIntGe,
+    5,  // To the second PushInt.
+    KernelBytecode::kPushInt,
+    1,
+    KernelBytecode::kReturnTOS,
+    KernelBytecode::kPushInt,
+    0,
+    KernelBytecode::kReturnTOS,
+};
+
+// Same as above with the wide encoding of the jump offset.
+static const KBCInstr kJumpIfIntGeWideInstructions[] = {
+    KernelBytecode::kEntry,
+    0,
+    KernelBytecode::kPush,
+    static_cast<KBCInstr>(-6),
+    KernelBytecode::kPush,
+    static_cast<KBCInstr>(-5),
+    KernelBytecode::kJumpIfIntGe_Wide,
+    7,  // To the second PushInt.
+    0,
+    0,
+    KernelBytecode::kPushInt,
+    1,
+    KernelBytecode::kReturnTOS,
+    KernelBytecode::kPushInt,
+    0,
+    KernelBytecode::kReturnTOS,
+};
+
+static FunctionPtr CreateBytecodeFunction(const char* name,
+                                          const KBCInstr* instructions,
+                                          intptr_t instructions_size) {
+  Thread* thread = Thread::Current();
+  const Function& function = Function::Handle(CreateFunction(name));
+  const Bytecode& bytecode = Bytecode::Handle(Bytecode::New(
+      reinterpret_cast<uword>(instructions), instructions_size, -1,
+      TypedDataBase::Handle(), Object::empty_object_pool()));
+  bytecode.set_pc_descriptors(Object::empty_descriptors());
+  bytecode.set_exception_handlers(Object::empty_exception_handlers());
+  SafepointWriteRwLocker ml(thread, thread->isolate_group()->program_lock());
+  function.AttachBytecode(bytecode);
+  return function.ptr();
+}
+
+static ObjectPtr InvokeLessThan(const Function& function,
+                                const Object& a,
+                                const Object& b) {
+  const Array& args = Array::Handle(Array::New(2));
+  args.SetAt(0, a);
+  args.SetAt(1, b);
+  return DartEntry::InvokeFunction(function, args);
+}
+
+static void TestJumpIfIntGe(const Function& function) {
+  const Smi& one = Smi::Handle(Smi::New(1));
+  const Smi& two = Smi::Handle(Smi::New(2));
+  const Integer& large = Integer::Handle(Integer::New(kMaxInt64));
+  EXPECT(large.IsMint());
+
+  // Falls through when a < b.
+  EXPECT_EQ(Smi::New(1), InvokeLessThan(function, one, two));
+  EXPECT_EQ(Smi::New(1), InvokeLessThan(function, one, large));
+  // Jumps when a >= b.
+  EXPECT_EQ(Smi::New(0), InvokeLessThan(function, two, one));
+  EXPECT_EQ(Smi::New(0), InvokeLessThan(function, two, two));
+  EXPECT_EQ(Smi::New(0), InvokeLessThan(function, large, one));
+
+  // A null operand throws like CompareIntLt does.
+  Object& result =
+      Object::Handle(InvokeLessThan(function, Object::null_object(), one));
+  EXPECT(result.IsUnhandledException());
+  result = InvokeLessThan(function, one, Object::null_object());
+  EXPECT(result.IsUnhandledException());
+}
+
+ISOLATE_UNIT_TEST_CASE(Interpreter_JumpIfIntGe) {
+  const Function& function = Function::Handle(
+      CreateBytecodeFunction("lessThan", kJumpIfIntGeInstructions,
+                             sizeof(kJumpIfIntGeInstructions)));
+  TestJumpIfIntGe(function);
+}
+
+ISOLATE_UNIT_TEST_CASE(Interpreter_JumpIfIntGe_Wide) {
+  const Function& function = Function::Handle(
+      CreateBytecodeFunction("lessThanWide", kJumpIfIntGeWideInstructions,
+                             sizeof(kJumpIfIntGeWideInstructions)));
+  TestJumpIfIntGe(function);
+}
+
+}  // namespace dart
+
+#endif  // defined(DART_DYNAMIC_MODULES)
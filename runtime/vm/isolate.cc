@@ -16,6 +16,7 @@
 #include "vm/class_finalizer.h"
 #include "vm/code_observers.h"
 #include "vm/compiler/jit/compiler.h"
+#include "vm/coverage_bitmap.h"
 #include "vm/dart_api_message.h"
 #include "vm/dart_api_state.h"
 #include "vm/dart_entry.h"
@@ -1353,11 +1354,49 @@ bool Isolate::HasPendingMessages() {
   return message_handler_->HasMessages() || message_handler_->HasOOBMessages();
 }
 
+void Isolate::StartCpuTimeAccounting() {
+  cpu_time_start_micros_ = OS::GetCurrentThreadCPUMicros();
+}
+
+void Isolate::AccountCpuTime() {
+  // Platforms without a per-thread CPU clock report -1.
+  if (cpu_time_start_micros_ < 0) return;
+  const int64_t now = OS::GetCurrentThreadCPUMicros();
+  if (now > cpu_time_start_micros_) {
+    GetCpuTimeMetric()->increment_by(now - cpu_time_start_micros_);
+  }
+  cpu_time_start_micros_ = now;
+}
+
+// Charges the queueing delay of one message to the isolate's metrics, and
+// the CPU time spent so far once it is handled. HandleMessage has many exits,
+// hence the scope.
+class IsolateMessageMetricsScope : public ValueObject {
+ public:
+  IsolateMessageMetricsScope(Isolate* isolate, const Message& message)
+      : isolate_(isolate) {
+    isolate->GetMessagesHandledMetric()->increment();
+    const int64_t latency =
+        OS::GetCurrentMonotonicMicros() - message.enqueue_micros();
+    if (message.enqueue_micros() != 0 && latency > 0) {
+      isolate->GetMessageLatencyMetric()->increment_by(latency);
+    }
+  }
+
+  ~IsolateMessageMetricsScope() { isolate_->AccountCpuTime(); }
+
+ private:
+  Isolate* isolate_;
+
+  DISALLOW_COPY_AND_ASSIGN(IsolateMessageMetricsScope);
+};
+
 MessageHandler::MessageStatus IsolateMessageHandler::HandleMessage(
     std::unique_ptr<Message> message) {
 #ifdef DEBUG
   CheckAccess();
 #endif
+  IsolateMessageMetricsScope metrics_scope(I, *message);
   Thread* thread = Thread::Current();
   StackZone stack_zone(thread);
   Zone* zone = stack_zone.GetZone();
@@ -1473,6 +1512,7 @@ MessageHandler::MessageStatus IsolateMessageHandler::HandleMessage(
       // The handler closure which was used to successfully handle the message.
     }
   }
+  CoverageBitmap::MaybeFlush(thread);
   return status;
 }
 
@@ -1742,11 +1782,11 @@ Isolate::Isolate(IsolateGroup* isolate_group,
       pending_service_extension_calls_(GrowableObjectArray::null()),
       registered_service_extension_handlers_(GrowableObjectArray::null()),
       service_id_zones_(nullptr),
+#endif  // !defined(PRODUCT)
 #define ISOLATE_METRIC_CONSTRUCTORS(type, variable, name, unit)                \
   metric_##variable##_(),
       ISOLATE_METRIC_LIST(ISOLATE_METRIC_CONSTRUCTORS)
 #undef ISOLATE_METRIC_CONSTRUCTORS
-#endif  // !defined(PRODUCT)
           start_time_micros_(OS::GetCurrentMonotonicMicros()),
       message_notify_callback_(nullptr),
       on_shutdown_callback_(Isolate::ShutdownCallback()),
@@ -1843,14 +1883,12 @@ Isolate* Isolate::InitIsolate(const char* name_prefix,
 
   ASSERT(result != nullptr);
 
-#if !defined(PRODUCT)
 // Initialize metrics.
 #define ISOLATE_METRIC_INIT(type, variable, name, unit)                        \
   result->metric_##variable##_.InitInstance(result, name, nullptr,             \
                                             Metric::unit);
   ISOLATE_METRIC_LIST(ISOLATE_METRIC_INIT);
 #undef ISOLATE_METRIC_INIT
-#endif  // !defined(PRODUCT)
 
   // Setup the isolate message handler.
   result->message_handler_ = new IsolateMessageHandler(result);
@@ -2172,8 +2210,8 @@ void Isolate::MakeRunnableLocked() {
     ServiceEvent runnableEvent(this, ServiceEvent::kIsolateRunnable);
     Service::HandleEvent(&runnableEvent, /* enter_safepoint */ false);
   }
-  GetRunnableLatencyMetric()->set_value(UptimeMicros());
 #endif  // !PRODUCT
+  GetRunnableLatencyMetric()->set_value(UptimeMicros());
 }
 
 bool Isolate::VerifyPauseCapability(const Object& capability) const {
@@ -2573,6 +2611,12 @@ void Isolate::Shutdown() {
   }
 #endif  // !defined(PRODUCT) && !defined(DART_PRECOMPILED_RUNTIME)
 
+  if (is_runnable() && CoverageBitmap::IsEnabled(this)) {
+    StackZone zone(thread);
+    HandleScope handle_scope(thread);
+    CoverageBitmap::WriteToFile(thread);
+  }
+
   // Then, proceed with low-level teardown.
   Isolate::UnMarkIsolateReady(this);
 
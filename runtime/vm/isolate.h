@@ -1044,6 +1044,14 @@ class Isolate : public IntrusiveDListEntry<Isolate> {
 
   int64_t UptimeMicros() const;
 
+  // When the coverage bitmap was last written (see CoverageBitmap).
+  int64_t last_coverage_bitmap_flush_micros() const {
+    return last_coverage_bitmap_flush_micros_;
+  }
+  void set_last_coverage_bitmap_flush_micros(int64_t micros) {
+    last_coverage_bitmap_flush_micros_ = micros;
+  }
+
   Dart_Port main_port() const { return main_port_; }
   void set_main_port(Dart_Port port) {
     ASSERT(main_port_ == 0);  // Only set main port once.
@@ -1345,12 +1353,18 @@ class Isolate : public IntrusiveDListEntry<Isolate> {
     return OFFSET_OF(Isolate, default_tag_);
   }
 
-#if !defined(PRODUCT)
 #define ISOLATE_METRIC_ACCESSOR(type, variable, name, unit)                    \
   type* Get##variable##Metric() { return &metric_##variable##_; }
   ISOLATE_METRIC_LIST(ISOLATE_METRIC_ACCESSOR);
 #undef ISOLATE_METRIC_ACCESSOR
-#endif  // !defined(PRODUCT)
+
+  // Starts charging the CPU time of the current thread to isolate.cpu.time.
+  // Called when a thread enters the isolate.
+  void StartCpuTimeAccounting();
+
+  // Charges the CPU time the current thread spent in the isolate since the
+  // last call (or since it entered the isolate) to isolate.cpu.time.
+  void AccountCpuTime();
 
   static intptr_t IsolateListLength();
 
@@ -1660,15 +1674,19 @@ class Isolate : public IntrusiveDListEntry<Isolate> {
 
   // The array of Service ID zones is created lazily.
   MallocGrowableArray<RingServiceIdZone*>* service_id_zones_;
+#endif  // !defined(PRODUCT)
 
 #define ISOLATE_METRIC_VARIABLE(type, variable, name, unit)                    \
   type metric_##variable##_;
   ISOLATE_METRIC_LIST(ISOLATE_METRIC_VARIABLE);
 #undef ISOLATE_METRIC_VARIABLE
-#endif  // !defined(PRODUCT)
+  // Thread CPU time at which AccountCpuTime last charged the isolate, or -1
+  // if the platform has no per-thread CPU clock.
+  int64_t cpu_time_start_micros_ = -1;
 
   // All other fields go here.
   int64_t start_time_micros_;
+  int64_t last_coverage_bitmap_flush_micros_ = 0;
   std::atomic<Dart_MessageNotifyCallback> message_notify_callback_;
   Dart_IsolateShutdownCallback on_shutdown_callback_ = nullptr;
   Dart_IsolateCleanupCallback on_cleanup_callback_ = nullptr;
@@ -10,6 +10,7 @@
 #include "vm/dart_entry.h"
 #include "vm/json_stream.h"
 #include "vm/object.h"
+#include "vm/os.h"
 #include "vm/port.h"
 
 namespace dart {
@@ -101,6 +102,7 @@ void MessageQueue::Enqueue(std::unique_ptr<Message> msg0, bool before_events) {
 
   // Make sure messages are not reused.
   ASSERT(msg->next_ == nullptr);
+  msg->enqueue_micros_ = OS::GetCurrentMonotonicMicros();
   if (head_ == nullptr) {
     // Only element in the queue.
     ASSERT(tail_ == nullptr);
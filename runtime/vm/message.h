@@ -128,6 +128,9 @@ class Message {
 
   intptr_t Id() const;
 
+  // Monotonic time at which the message was put into a MessageQueue.
+  int64_t enqueue_micros() const { return enqueue_micros_; }
+
   static const char* PriorityAsString(Priority priority);
 
  private:
@@ -151,6 +154,7 @@ class Message {
   intptr_t snapshot_length_ = 0;
   MessageFinalizableData* finalizable_data_ = nullptr;
   Priority priority_;
+  int64_t enqueue_micros_ = 0;
 
   DISALLOW_COPY_AND_ASSIGN(Message);
 };
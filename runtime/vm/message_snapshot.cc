@@ -321,6 +321,10 @@ class ApiMessageSerializer : public BaseSerializer {
   void AddBaseObjects();
   bool Serialize(Dart_CObject* root);
 
+  // Whether [root] can be written by WriteFlat.
+  bool IsFlat(Dart_CObject* root);
+  void WriteFlat(Dart_CObject* object);
+
   void WriteRef(Dart_CObject* object) {
     intptr_t index = GetObjectId(object);
     ASSERT(index != WeakTable::kNoValue);
@@ -409,6 +413,7 @@ class MessageDeserializer : public BaseDeserializer {
 
   void AddBaseObjects();
   ObjectPtr Deserialize();
+  ObjectPtr ReadFlat();
 
   Thread* thread() const { return thread_; }
   IsolateGroup* isolate_group() const { return thread_->isolate_group(); }
@@ -447,6 +452,7 @@ class ApiMessageDeserializer : public BaseDeserializer {
 
   void AddBaseObjects();
   Dart_CObject* Deserialize();
+  Dart_CObject* ReadFlat();
 
  private:
   Dart_CObject** refs_;
@@ -2686,6 +2692,10 @@ class TwoByteStringMessageDeserializationCluster
 static constexpr intptr_t kFirstReference = 1;
 static constexpr intptr_t kUnallocatedReference = -1;
 
+// Clustered messages start with their number of base objects, which is never
+// zero. Flat messages start with this tag instead.
+static constexpr intptr_t kFlatMessageTag = 0;
+
 BaseSerializer::BaseSerializer(Thread* thread, Zone* zone)
     : StackResource(thread),
       zone_(zone),
@@ -3294,6 +3304,12 @@ void MessageSerializer::Serialize(const Object& root) {
 }
 
 bool ApiMessageSerializer::Serialize(Dart_CObject* root) {
+  if (IsFlat(root)) {
+    WriteUnsigned(kFlatMessageTag);
+    WriteFlat(root);
+    return true;
+  }
+
   AddBaseObjects();
 
   Push(root);
@@ -3337,6 +3353,9 @@ bool ApiMessageSerializer::Serialize(Dart_CObject* root) {
 
 ObjectPtr MessageDeserializer::Deserialize() {
   intptr_t num_base_objects = ReadUnsigned();
+  if (num_base_objects == kFlatMessageTag) {
+    return ReadFlat();
+  }
   intptr_t num_objects = ReadUnsigned();
 
   refs_ = Array::New(num_objects + kFirstReference);
@@ -3375,6 +3394,9 @@ ObjectPtr MessageDeserializer::Deserialize() {
 
 Dart_CObject* ApiMessageDeserializer::Deserialize() {
   intptr_t num_base_objects = ReadUnsigned();
+  if (num_base_objects == kFlatMessageTag) {
+    return ReadFlat();
+  }
   intptr_t num_objects = ReadUnsigned();
 
   refs_ = zone()->Alloc<Dart_CObject*>(num_objects + kFirstReference);
@@ -3407,6 +3429,270 @@ Dart_CObject* ApiMessageDeserializer::Deserialize() {
   return ReadRef();
 }
 
+// The internal typed data class id for [type], or kIllegalCid.
+static intptr_t TypedDataCid(Dart_TypedData_Type type) {
+  switch (type) {
+    case Dart_TypedData_kInt8:
+      return kTypedDataInt8ArrayCid;
+    case Dart_TypedData_kUint8:
+      return kTypedDataUint8ArrayCid;
+    case Dart_TypedData_kUint8Clamped:
+      return kTypedDataUint8ClampedArrayCid;
+    case Dart_TypedData_kInt16:
+      return kTypedDataInt16ArrayCid;
+    case Dart_TypedData_kUint16:
+      return kTypedDataUint16ArrayCid;
+    case Dart_TypedData_kInt32:
+      return kTypedDataInt32ArrayCid;
+    case Dart_TypedData_kUint32:
+      return kTypedDataUint32ArrayCid;
+    case Dart_TypedData_kInt64:
+      return kTypedDataInt64ArrayCid;
+    case Dart_TypedData_kUint64:
+      return kTypedDataUint64ArrayCid;
+    case Dart_TypedData_kFloat32:
+      return kTypedDataFloat32ArrayCid;
+    case Dart_TypedData_kFloat64:
+      return kTypedDataFloat64ArrayCid;
+    case Dart_TypedData_kInt32x4:
+      return kTypedDataInt32x4ArrayCid;
+    case Dart_TypedData_kFloat32x4:
+      return kTypedDataFloat32x4ArrayCid;
+    case Dart_TypedData_kFloat64x2:
+      return kTypedDataFloat64x2ArrayCid;
+    default:
+      return kIllegalCid;
+  }
+}
+
+// Whether [object] is a scalar, a valid string or valid typed data, which
+// the flat encoding writes without references to other objects.
+static bool IsFlatLeaf(Dart_CObject* object) {
+  switch (object->type) {
+    case Dart_CObject_kNull:
+    case Dart_CObject_kBool:
+    case Dart_CObject_kInt32:
+    case Dart_CObject_kInt64:
+    case Dart_CObject_kDouble:
+      return true;
+    case Dart_CObject_kString: {
+      if (object->value.as_string == nullptr) return false;
+      const uint8_t* utf8_str =
+          reinterpret_cast<const uint8_t*>(object->value.as_string);
+      intptr_t utf8_len = strlen(object->value.as_string);
+      if (!Utf8::IsValid(utf8_str, utf8_len)) return false;
+      Utf8::Type type = Utf8::kLatin1;
+      return Utf8::CodeUnitCount(utf8_str, utf8_len, &type) <=
+             String::kMaxElements;
+    }
+    case Dart_CObject_kTypedData: {
+      const intptr_t cid = TypedDataCid(object->value.as_typed_data.type);
+      const intptr_t length = object->value.as_typed_data.length;
+      return (cid != kIllegalCid) && (length >= 0) &&
+             (length <= TypedData::MaxElements(cid));
+    }
+    default:
+      return false;
+  }
+}
+
+// Flat messages hold a double, a string, typed data, or an array of these
+// and of other scalars. They are written in one pass without clusters or
+// references: every object is its Dart_CObject_Type followed by its value,
+// strings as UTF-8 and typed data as their bytes. Anything else, including
+// invalid values, takes the clustered path, which reports the error.
+bool ApiMessageSerializer::IsFlat(Dart_CObject* root) {
+  if (root->type != Dart_CObject_kArray) {
+    return IsFlatLeaf(root);
+  }
+  if (!Array::IsValidLength(root->value.as_array.length)) {
+    return false;
+  }
+  bool is_flat = true;
+  bool has_marks = false;
+  for (intptr_t i = 0; i < root->value.as_array.length; i++) {
+    Dart_CObject* element = root->value.as_array.values[i];
+    if (!IsFlatLeaf(element)) {
+      is_flat = false;
+      break;
+    }
+    // The clustered encoding keeps the identity of strings and typed data
+    // that appear more than once. The flat one would copy them.
+    if ((element->type == Dart_CObject_kString) ||
+        (element->type == Dart_CObject_kTypedData)) {
+      has_marks = true;
+      if (!MarkObjectId(element, kUnallocatedReference)) {
+        is_flat = false;
+        break;
+      }
+    }
+  }
+  if (has_marks) {
+    forward_table_.Reset();
+  }
+  return is_flat;
+}
+
+void ApiMessageSerializer::WriteFlat(Dart_CObject* object) {
+  switch (object->type) {
+    case Dart_CObject_kNull:
+      WriteUnsigned(Dart_CObject_kNull);
+      break;
+    case Dart_CObject_kBool:
+      WriteUnsigned(Dart_CObject_kBool);
+      Write<uint8_t>(object->value.as_bool ? 1 : 0);
+      break;
+    case Dart_CObject_kInt32:
+      WriteUnsigned(Dart_CObject_kInt64);
+      Write<int64_t>(object->value.as_int32);
+      break;
+    case Dart_CObject_kInt64:
+      WriteUnsigned(Dart_CObject_kInt64);
+      Write<int64_t>(object->value.as_int64);
+      break;
+    case Dart_CObject_kDouble:
+      WriteUnsigned(Dart_CObject_kDouble);
+      Write<double>(object->value.as_double);
+      break;
+    case Dart_CObject_kString: {
+      WriteUnsigned(Dart_CObject_kString);
+      intptr_t utf8_len = strlen(object->value.as_string);
+      WriteUnsigned(utf8_len);
+      WriteBytes(object->value.as_string, utf8_len);
+      break;
+    }
+    case Dart_CObject_kTypedData: {
+      WriteUnsigned(Dart_CObject_kTypedData);
+      const Dart_TypedData_Type type = object->value.as_typed_data.type;
+      const intptr_t length = object->value.as_typed_data.length;
+      WriteUnsigned(type);
+      WriteUnsigned(length);
+      WriteBytes(object->value.as_typed_data.values,
+                 length * TypedData::ElementSizeInBytes(TypedDataCid(type)));
+      break;
+    }
+    case Dart_CObject_kArray: {
+      WriteUnsigned(Dart_CObject_kArray);
+      const intptr_t length = object->value.as_array.length;
+      WriteUnsigned(length);
+      for (intptr_t i = 0; i < length; i++) {
+        WriteFlat(object->value.as_array.values[i]);
+      }
+      break;
+    }
+    default:
+      UNREACHABLE();
+  }
+}
+
+ObjectPtr MessageDeserializer::ReadFlat() {
+  switch (ReadUnsigned()) {
+    case Dart_CObject_kNull:
+      return Object::null();
+    case Dart_CObject_kBool:
+      return Bool::Get(Read<uint8_t>() != 0).ptr();
+    case Dart_CObject_kInt64:
+      return Integer::New(Read<int64_t>());
+    case Dart_CObject_kDouble:
+      return Double::New(Read<double>());
+    case Dart_CObject_kString: {
+      const intptr_t utf8_len = ReadUnsigned();
+      const uint8_t* utf8_str = CurrentBufferAddress();
+      Advance(utf8_len);
+      return String::FromUTF8(utf8_str, utf8_len);
+    }
+    case Dart_CObject_kTypedData: {
+      const intptr_t cid =
+          TypedDataCid(static_cast<Dart_TypedData_Type>(ReadUnsigned()));
+      const intptr_t length = ReadUnsigned();
+      const TypedData& data =
+          TypedData::Handle(zone(), TypedData::New(cid, length));
+      NoSafepointScope no_safepoint;
+      ReadBytes(data.DataAddr(0),
+                length * TypedData::ElementSizeInBytes(cid));
+      return data.ptr();
+    }
+    case Dart_CObject_kArray: {
+      const intptr_t length = ReadUnsigned();
+      const Array& array = Array::Handle(zone(), Array::New(length));
+      Object& element = Object::Handle(zone());
+      for (intptr_t i = 0; i < length; i++) {
+        element = ReadFlat();
+        array.SetAt(i, element);
+      }
+      return array.ptr();
+    }
+    default:
+      UNREACHABLE();
+      return Object::null();
+  }
+}
+
+Dart_CObject* ApiMessageDeserializer::ReadFlat() {
+  switch (ReadUnsigned()) {
+    case Dart_CObject_kNull:
+      return PredefinedCObjects::cobj_null();
+    case Dart_CObject_kBool:
+      return Read<uint8_t>() != 0 ? &cobj_true : &cobj_false;
+    case Dart_CObject_kInt64: {
+      // Same split as the clustered encoding.
+      const int64_t value = Read<int64_t>();
+      Dart_CObject* result;
+      if ((kMinInt32 <= value) && (value <= kMaxInt32)) {
+        result = Allocate(Dart_CObject_kInt32);
+        result->value.as_int32 = value;
+      } else {
+        result = Allocate(Dart_CObject_kInt64);
+        result->value.as_int64 = value;
+      }
+      return result;
+    }
+    case Dart_CObject_kDouble: {
+      Dart_CObject* result = Allocate(Dart_CObject_kDouble);
+      result->value.as_double = Read<double>();
+      return result;
+    }
+    case Dart_CObject_kString: {
+      Dart_CObject* result = Allocate(Dart_CObject_kString);
+      const intptr_t utf8_len = ReadUnsigned();
+      char* utf8_str = zone()->Alloc<char>(utf8_len + 1);
+      ReadBytes(utf8_str, utf8_len);
+      utf8_str[utf8_len] = '\0';
+      result->value.as_string = utf8_str;
+      return result;
+    }
+    case Dart_CObject_kTypedData: {
+      Dart_CObject* result = Allocate(Dart_CObject_kTypedData);
+      const Dart_TypedData_Type type =
+          static_cast<Dart_TypedData_Type>(ReadUnsigned());
+      const intptr_t length = ReadUnsigned();
+      result->value.as_typed_data.type = type;
+      result->value.as_typed_data.length = length;
+      if (length == 0) {
+        result->value.as_typed_data.values = nullptr;
+      } else {
+        result->value.as_typed_data.values = CurrentBufferAddress();
+        Advance(length * TypedData::ElementSizeInBytes(TypedDataCid(type)));
+      }
+      return result;
+    }
+    case Dart_CObject_kArray: {
+      Dart_CObject* result = Allocate(Dart_CObject_kArray);
+      const intptr_t length = ReadUnsigned();
+      result->value.as_array.length = length;
+      result->value.as_array.values =
+          length == 0 ? nullptr : zone()->Alloc<Dart_CObject*>(length);
+      for (intptr_t i = 0; i < length; i++) {
+        result->value.as_array.values[i] = ReadFlat();
+      }
+      return result;
+    }
+    default:
+      UNREACHABLE();
+      return nullptr;
+  }
+}
+
 std::unique_ptr<Message> WriteMessage(bool same_group,
                                       const Object& obj,
                                       Dart_Port dest_port,
@@ -3431,6 +3717,10 @@ std::unique_ptr<Message> WriteApiMessage(Zone* zone,
                                          Dart_CObject* obj,
                                          Dart_Port dest_port,
                                          Message::Priority priority) {
+  ObjectPtr raw_obj;
+  if (ApiObjectConverter::ConvertToRaw(obj, &raw_obj)) {
+    return Message::New(dest_port, raw_obj, priority);
+  }
   ApiMessageSerializer serializer(zone);
   if (!serializer.Serialize(obj)) {
     return nullptr;
@@ -35,7 +35,6 @@ void Metric::InitInstance(IsolateGroup* isolate_group,
   unit_ = unit;
 }
 
-#if !defined(PRODUCT)
 void Metric::InitInstance(Isolate* isolate,
                           const char* name,
                           const char* description,
@@ -48,6 +47,8 @@ void Metric::InitInstance(Isolate* isolate,
   unit_ = unit;
 }
 
+#if !defined(PRODUCT)
+
 void Metric::InitInstance(const char* name,
                           const char* description,
                           Unit unit) {
@@ -45,10 +45,17 @@ class JSONStream;
 
 // Metrics for each isolate.
 //
+// Like the isolate group metrics they are kept in PRODUCT builds, where
+// embedders read them via Dart_Isolate<name>Metric.
+//
 // All metrics are exposed via vm-service protocol.
 #define ISOLATE_METRIC_LIST(V)                                                 \
   V(Metric, RunnableLatency, "isolate.runnable.latency", kMicrosecond)         \
-  V(Metric, RunnableHeapSize, "isolate.runnable.heap", kByte)
+  V(Metric, RunnableHeapSize, "isolate.runnable.heap", kByte)                  \
+  V(Metric, CpuTime, "isolate.cpu.time", kMicrosecond)                         \
+  V(Metric, AllocatedBytes, "isolate.allocated", kByte)                        \
+  V(Metric, MessagesHandled, "isolate.messages.handled", kCounter)             \
+  V(Metric, MessageLatency, "isolate.messages.latency", kMicrosecond)
 
 class Metric {
  public:
@@ -96,6 +103,7 @@ class Metric {
   void set_value(int64_t value) { value_ = value; }
 
   void increment() { value_++; }
+  void increment_by(int64_t amount) { value_ += amount; }
 
   const char* name() const { return name_; }
   const char* description() const { return description_; }
@@ -31,6 +31,8 @@ VM_UNIT_TEST_CASE(Metric_Simple) {
     EXPECT_EQ(1, metric.value());
     metric.set_value(44);
     EXPECT_EQ(44, metric.value());
+    metric.increment_by(6);
+    EXPECT_EQ(50, metric.value());
   }
   Dart_ShutdownIsolate();
 }
@@ -74,8 +76,54 @@ VM_UNIT_TEST_CASE(Metric_OnDemand) {
   }
   Dart_ShutdownIsolate();
 }
+
 #endif  // !defined(PRODUCT)
 
+ISOLATE_UNIT_TEST_CASE(Metric_IsolateAllocatedBytes) {
+  Isolate* isolate = thread->isolate();
+  int64_t before = isolate->GetAllocatedBytesMetric()->value();
+  for (intptr_t i = 0; i < 100; i++) {
+    String::New("<land-in-new-space>", Heap::kNew);
+  }
+  // Releasing the TLAB charges everything allocated from it.
+  thread->heap()->CollectGarbage(thread, GCType::kScavenge,
+                                 GCReason::kDebugging);
+  int64_t after = isolate->GetAllocatedBytesMetric()->value();
+  EXPECT(after - before >= 100 * String::InstanceSize());
+
+  // Old space and large objects are charged as they are allocated.
+  before = after;
+  Array::Handle(Array::New(10, Heap::kOld));
+  after = isolate->GetAllocatedBytesMetric()->value();
+  EXPECT_EQ(Array::InstanceSize(10), after - before);
+  before = after;
+  const intptr_t kLargeLength = 1 * MB;
+  TypedData::Handle(
+      TypedData::New(kTypedDataUint8ArrayCid, kLargeLength, Heap::kOld));
+  after = isolate->GetAllocatedBytesMetric()->value();
+  EXPECT(after - before >= kLargeLength);
+
+  TransitionVMToNative transition(thread);
+  EXPECT_EQ(after, Dart_IsolateAllocatedBytesMetric(Dart_CurrentIsolate()));
+}
+
+VM_UNIT_TEST_CASE(Metric_IsolateCpuTime) {
+  if (OS::GetCurrentThreadCPUMicros() < 0) return;  // No per-thread CPU clock.
+
+  Dart_Isolate isolate = TestCase::CreateTestIsolate();
+  const int64_t before = Dart_IsolateCpuTimeMetric(isolate);
+  const int64_t start = OS::GetCurrentThreadCPUMicros();
+  const int64_t kBusyMicros = 1000;
+  while (OS::GetCurrentThreadCPUMicros() - start < kBusyMicros) {
+  }
+  // Leaving the isolate charges the CPU time spent in it since it was
+  // entered.
+  Dart_ExitIsolate();
+  EXPECT(Dart_IsolateCpuTimeMetric(isolate) - before >= kBusyMicros);
+  Dart_EnterIsolate(isolate);
+  Dart_ShutdownIsolate();
+}
+
 ISOLATE_UNIT_TEST_CASE(Metric_EmbedderAPI) {
   {
     TransitionVMToNative transition(thread);
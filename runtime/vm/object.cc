@@ -24765,13 +24765,102 @@ StringPtr String::Transform(int32_t (*mapping)(int32_t ch),
   return TwoByteString::Transform(mapping, str, space);
 }
 
+// Returns the index of the first code unit in |chars| which is changed by
+// |mapping|, or |len| if the mapping leaves all of them unchanged.
+//
+// Eight code units are checked at a time as long as they are all ASCII: a
+// block without any code unit in [kFirst, kLast] is unchanged by the mapping.
+template <uint8_t kFirst, uint8_t kLast>
+static intptr_t FindFirstCaseChange(int32_t (*mapping)(int32_t ch),
+                                    const uint8_t* chars,
+                                    intptr_t len) {
+  constexpr uint64_t kOnes = 0x0101010101010101;
+  constexpr uint64_t kHighBits = 0x8080808080808080;
+  intptr_t i = 0;
+  while (i < len) {
+    if (i + 8 <= len) {
+      const uint64_t block = LoadUnaligned(
+          reinterpret_cast<const uint64_t*>(chars + i));
+      if ((block & kHighBits) == 0) {
+        // For ASCII code units these additions do not carry into the next
+        // byte, and set its high bit iff the code unit is >= kFirst
+        // (resp. > kLast).
+        const uint64_t at_least_first = block + kOnes * (0x80 - kFirst);
+        const uint64_t above_last = block + kOnes * (0x7f - kLast);
+        if ((at_least_first & ~above_last & kHighBits) == 0) {
+          i += 8;
+          continue;
+        }
+      }
+    }
+    const int32_t ch = chars[i];
+    if (mapping(ch) != ch) {
+      return i;
+    }
+    i++;
+  }
+  return len;
+}
+
+template <uint8_t kFirst, uint8_t kLast>
+StringPtr OneByteString::ChangeCase(int32_t (*mapping)(int32_t ch),
+                                    const String& str,
+                                    Heap::Space space) {
+  ASSERT(str.IsOneByteString());
+  const intptr_t len = str.Length();
+  if (len == 0) {
+    return str.ptr();
+  }
+  intptr_t first_change;
+  {
+    NoSafepointScope no_safepoint;
+    first_change = FindFirstCaseChange<kFirst, kLast>(
+        mapping, OneByteString::CharAddr(str, 0), len);
+  }
+  if (first_change == len) {
+    return str.ptr();
+  }
+  const String& result = String::Handle(OneByteString::New(len, space));
+  NoSafepointScope no_safepoint;
+  const uint8_t* src = OneByteString::CharAddr(str, 0);
+  uint8_t* dst = OneByteString::CharAddr(result, 0);
+  memmove(dst, src, first_change);
+  for (intptr_t i = first_change; i < len; i++) {
+    const int32_t ch = src[i];
+    if (ch < 0x80) {
+      dst[i] = (kFirst <= ch && ch <= kLast) ? (ch ^ 0x20) : ch;
+    } else {
+      const int32_t mapped = mapping(ch);
+      if (!Utf::IsLatin1(mapped)) {
+        return String::null();
+      }
+      dst[i] = mapped;
+    }
+  }
+  return result.ptr();
+}
+
 StringPtr String::ToUpperCase(const String& str, Heap::Space space) {
-  // TODO(cshapiro): create a fast-path for OneByteString instances.
+  if (str.IsOneByteString()) {
+    const String& result = String::Handle(
+        OneByteString::ChangeCase<'a', 'z'>(CaseMapping::ToUpper, str,
+                                            space));
+    if (!result.IsNull()) {
+      return result.ptr();
+    }
+  }
   return Transform(CaseMapping::ToUpper, str, space);
 }
 
 StringPtr String::ToLowerCase(const String& str, Heap::Space space) {
-  // TODO(cshapiro): create a fast-path for OneByteString instances.
+  if (str.IsOneByteString()) {
+    const String& result = String::Handle(
+        OneByteString::ChangeCase<'A', 'Z'>(CaseMapping::ToLower, str,
+                                            space));
+    if (!result.IsNull()) {
+      return result.ptr();
+    }
+  }
   return Transform(CaseMapping::ToLower, str, space);
 }
 
@@ -10695,6 +10695,15 @@ class OneByteString : public AllStatic {
     return reinterpret_cast<const UntaggedOneByteString*>(str.untag());
   }
 
+  // Case mapping for String::ToUpperCase and String::ToLowerCase, where
+  // [kFirst, kLast] are the ASCII code units changed by |mapping|. Returns
+  // |str| itself if no code unit changes, or null if the result does not fit
+  // in a OneByteString.
+  template <uint8_t kFirst, uint8_t kLast>
+  static StringPtr ChangeCase(int32_t (*mapping)(int32_t ch),
+                              const String& str,
+                              Heap::Space space);
+
   static uint8_t* CharAddr(const String& str, intptr_t index) {
     ASSERT((index >= 0) && (index < str.Length()));
     ASSERT(str.IsOneByteString());
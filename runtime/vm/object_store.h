@@ -276,6 +276,7 @@ class ObjectPointerVisitor;
   RW(Array, ffi_callback_functions)                                            \
   RW(Code, resume_stub)                                                        \
   RW(Code, slow_tts_stub)                                                      \
+  RW(Array, aot_coverage)                                                      \
   /* Roots for JIT/AOT snapshots are up until here (see to_snapshot() below)*/ \
   RW(Code, await_stub)                                                         \
   RW(Code, await_with_type_check_stub)                                         \
@@ -613,7 +614,7 @@ class ObjectStore {
         return reinterpret_cast<ObjectPtr*>(&global_object_pool_);
       case Snapshot::kFullJIT:
       case Snapshot::kFullAOT:
-        return reinterpret_cast<ObjectPtr*>(&slow_tts_stub_);
+        return reinterpret_cast<ObjectPtr*>(&aot_coverage_);
       case Snapshot::kNone:
       case Snapshot::kInvalid:
         break;
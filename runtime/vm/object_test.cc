@@ -849,6 +849,47 @@ ISOLATE_UNIT_TEST_CASE(StringFormat) {
   EXPECT(str.Equals(hello_str));
 }
 
+ISOLATE_UNIT_TEST_CASE(StringCaseMapping) {
+  // Long enough for several eight code unit blocks, ending in a Latin-1
+  // letter (U+00E0 and U+00C0) encoded as UTF-8.
+  const String& lower = String::Handle(
+      String::New("content-type: application/json; charset=utf-8\xc3\xa0"));
+  const String& upper = String::Handle(
+      String::New("CONTENT-TYPE: APPLICATION/JSON; CHARSET=UTF-8\xc3\x80"));
+  EXPECT(lower.IsOneByteString());
+  EXPECT(upper.IsOneByteString());
+
+  // Unchanged strings are returned as is.
+  EXPECT_EQ(lower.ptr(), String::ToLowerCase(lower));
+  EXPECT_EQ(upper.ptr(), String::ToUpperCase(upper));
+
+  String& result = String::Handle(String::ToUpperCase(lower));
+  EXPECT(result.IsOneByteString());
+  EXPECT(result.Equals(upper));
+  result = String::ToLowerCase(upper);
+  EXPECT(result.IsOneByteString());
+  EXPECT(result.Equals(lower));
+
+  // Only the last code unit changes.
+  const String& mixed =
+      String::Handle(String::New("content-type: application/json;X"));
+  result = String::ToLowerCase(mixed);
+  EXPECT(result.Equals("content-type: application/json;x"));
+
+  // U+00FF upper-cases to U+0178, which needs a two-byte string.
+  const String& y_diaeresis = String::Handle(String::New("abcdefghij\xc3\xbf"));
+  result = String::ToUpperCase(y_diaeresis);
+  EXPECT(result.IsTwoByteString());
+  EXPECT_EQ(11, result.Length());
+  EXPECT_EQ('A', result.CharAt(0));
+  EXPECT_EQ(0x178, result.CharAt(10));
+
+  const String& empty = String::Handle(String::New(""));
+  EXPECT(empty.IsOneByteString());
+  EXPECT_EQ(empty.ptr(), String::ToLowerCase(empty));
+  EXPECT_EQ(empty.ptr(), String::ToUpperCase(empty));
+}
+
 ISOLATE_UNIT_TEST_CASE(StringConcat) {
   // Create strings from concatenated 1-byte empty strings.
   {
@@ -0,0 +1,118 @@
+// Copyright (c) 2026, the Dart project authors.  Please see the AUTHORS file
+// for details. All rights reserved. Use of this source code is governed by a
+// BSD-style license that can be found in the LICENSE file.
+
+#include "vm/safepoint_poll_page.h"
+
+#include "platform/atomic.h"
+#include "platform/utils.h"
+#include "vm/flags.h"
+#include "vm/os.h"
+#include "vm/virtual_memory.h"
+
+#if defined(SUPPORT_SAFEPOINT_POLL_PAGE)
+#include <signal.h>    // NOLINT
+#include <ucontext.h>  // NOLINT
+
+#include "vm/instructions.h"
+#endif
+
+namespace dart {
+
+uword SafepointPollPage::disarmed_page_ = 0;
+uword SafepointPollPage::armed_page_ = 0;
+static RelaxedAtomic<intptr_t> handled_faults_ = {0};
+
+intptr_t SafepointPollPage::handled_faults() {
+  return handled_faults_.load();
+}
+
+#if defined(SUPPORT_SAFEPOINT_POLL_PAGE)
+static VirtualMemory* poll_pages_ = nullptr;
+static struct sigaction previous_action_ = {};
+
+static void HandleSegv(int signal, siginfo_t* info, void* context) {
+  const uword fault_address = reinterpret_cast<uword>(info->si_addr);
+  const uword armed_page = SafepointPollPage::armed_page();
+  if (fault_address == armed_page) {
+    ucontext_t* ucontext = reinterpret_cast<ucontext_t*>(context);
+    const uword pc = static_cast<uword>(ucontext->uc_mcontext.gregs[REG_RIP]);
+    SafepointPollPattern poll(pc);
+    if (poll.IsValid()) {
+      // Resume at the slow path of the interrupt check, which returns to the
+      // instruction after the poll.
+      ucontext->uc_mcontext.gregs[REG_RIP] =
+          static_cast<greg_t>(poll.slow_path());
+      handled_faults_.fetch_add(1);
+      return;
+    }
+  }
+
+  // Not ours: hand the fault to whoever was installed before us.
+  if ((previous_action_.sa_flags & SA_SIGINFO) != 0) {
+    previous_action_.sa_sigaction(signal, info, context);
+    return;
+  }
+  if (previous_action_.sa_handler == SIG_DFL ||
+      previous_action_.sa_handler == SIG_IGN) {
+    // Returning re-executes the faulting instruction, which then takes the
+    // default action.
+    struct sigaction act = {};
+    act.sa_handler = SIG_DFL;
+    sigemptyset(&act.sa_mask);
+    sigaction(SIGSEGV, &act, nullptr);
+    return;
+  }
+  previous_action_.sa_handler(signal);
+}
+#endif  // defined(SUPPORT_SAFEPOINT_POLL_PAGE)
+
+char* SafepointPollPage::Init() {
+  // The flag cannot be turned off here: it may have come from an AOT
+  // snapshot whose code already polls, and it is part of the snapshot
+  // features.
+  if (!FLAG_use_safepoint_poll_page) return nullptr;
+#if defined(SUPPORT_SAFEPOINT_POLL_PAGE)
+  ASSERT(poll_pages_ == nullptr);
+  const intptr_t page_size = VirtualMemory::PageSize();
+  poll_pages_ = VirtualMemory::Allocate(2 * page_size, /*is_executable=*/false,
+                                        /*is_compressed=*/false,
+                                        "dart-safepoint-poll");
+  if (poll_pages_ == nullptr) {
+    return Utils::StrDup("Failed to allocate safepoint poll pages");
+  }
+  disarmed_page_ = poll_pages_->start();
+  armed_page_ = disarmed_page_ + page_size;
+  VirtualMemory::Protect(reinterpret_cast<void*>(disarmed_page_), page_size,
+                         VirtualMemory::kReadOnly);
+  VirtualMemory::Protect(reinterpret_cast<void*>(armed_page_), page_size,
+                         VirtualMemory::kNoAccess);
+
+  struct sigaction act = {};
+  act.sa_sigaction = HandleSegv;
+  sigemptyset(&act.sa_mask);
+  act.sa_flags = SA_SIGINFO | SA_ONSTACK;
+  int r = sigaction(SIGSEGV, &act, &previous_action_);
+  ASSERT(r == 0);
+#elif !defined(DART_PRECOMPILER)
+  // Cross-compiling AOT snapshots only needs the code generator; everywhere
+  // else the loop polls would never be armed.
+  return Utils::StrDup(
+      "--use_safepoint_poll_page is only supported on Linux x64");
+#endif
+  return nullptr;
+}
+
+void SafepointPollPage::Cleanup() {
+#if defined(SUPPORT_SAFEPOINT_POLL_PAGE)
+  if (poll_pages_ == nullptr) return;
+  int r = sigaction(SIGSEGV, &previous_action_, nullptr);
+  ASSERT(r == 0);
+  delete poll_pages_;
+  poll_pages_ = nullptr;
+  disarmed_page_ = 0;
+  armed_page_ = 0;
+#endif
+}
+
+}  // namespace dart
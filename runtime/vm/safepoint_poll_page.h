@@ -0,0 +1,55 @@
+// Copyright (c) 2026, the Dart project authors.  Please see the AUTHORS file
+// for details. All rights reserved. Use of this source code is governed by a
+// BSD-style license that can be found in the LICENSE file.
+
+#ifndef RUNTIME_VM_SAFEPOINT_POLL_PAGE_H_
+#define RUNTIME_VM_SAFEPOINT_POLL_PAGE_H_
+
+#include "vm/allocation.h"
+#include "vm/globals.h"
+
+namespace dart {
+
+#if defined(DART_HOST_OS_LINUX) && defined(TARGET_ARCH_X64) &&                 \
+    !defined(USING_SIMULATOR)
+#define SUPPORT_SAFEPOINT_POLL_PAGE
+#endif
+
+// Backs the loop interrupt checks emitted under --use_safepoint_poll_page.
+//
+// Instead of comparing the stack pointer against Thread::stack_limit_ and
+// branching, optimized loops load from the page Thread::safepoint_poll_page_
+// points to. That is the readable page until an interrupt is scheduled for
+// the thread, at which point it is switched to the protected page. The load
+// then faults and the SIGSEGV handler resumes the thread at the slow path of
+// the check, whose offset is encoded right after the load (see
+// SafepointPollPattern).
+//
+// The handler is installed by Init and forwards faults it does not own to the
+// SIGSEGV handler that was installed at that point. Embedders which install
+// their own SIGSEGV handler must do so before Dart_Initialize and forward
+// faults they do not own, or not use --use_safepoint_poll_page: a handler
+// installed afterwards replaces ours, and the first armed poll then crashes.
+class SafepointPollPage : public AllStatic {
+ public:
+  // Returns an error if --use_safepoint_poll_page is set but the pages cannot
+  // be set up.
+  static char* Init();
+  static void Cleanup();
+
+  // The page loop polls load from while no interrupt is pending, or 0 if
+  // polling is disabled.
+  static uword disarmed_page() { return disarmed_page_; }
+  static uword armed_page() { return armed_page_; }
+
+  // Number of faulting polls the SIGSEGV handler resumed at their slow path.
+  static intptr_t handled_faults();
+
+ private:
+  static uword disarmed_page_;
+  static uword armed_page_;
+};
+
+}  // namespace dart
+
+#endif  // RUNTIME_VM_SAFEPOINT_POLL_PAGE_H_
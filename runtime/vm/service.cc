@@ -1673,6 +1673,17 @@ static void GetIsolateGroupMemoryUsage(Thread* thread, JSONStream* js) {
   });
 }
 
+static const MethodParameter* const get_time_to_safepoint_params[] = {
+    ISOLATE_GROUP_PARAMETER,
+    nullptr,
+};
+
+static void GetTimeToSafepoint(Thread* thread, JSONStream* js) {
+  ActOnIsolateGroup(js, [&](IsolateGroup* isolate_group) {
+    isolate_group->safepoint_handler()->PrintTimeToSafepointJSON(js);
+  });
+}
+
 static const MethodParameter* const get_isolate_pause_event_params[] = {
     ISOLATE_PARAMETER,
     nullptr,
@@ -6187,6 +6198,8 @@ static const ServiceMethodDescriptor service_methods_[] = {
     get_stack_params },
   { "_getTagProfile", GetTagProfile,
     get_tag_profile_params },
+  { "_getTimeToSafepoint", GetTimeToSafepoint,
+    get_time_to_safepoint_params },
   { "_getTypeArgumentsList", GetTypeArgumentsList,
     get_type_arguments_list_params },
   { "getVersion", GetVersion,
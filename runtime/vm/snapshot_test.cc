@@ -277,6 +277,118 @@ ISOLATE_UNIT_TEST_CASE(SerializeDouble) {
   CheckEncodeDecodeMessage(scope.zone(), root);
 }
 
+ISOLATE_UNIT_TEST_CASE(SerializeApiRawValues) {
+  StackZone zone(thread);
+  ApiNativeScope scope;
+
+  // Null, booleans and integers in Smi range are sent without serialization.
+  Dart_CObject values[5];
+  values[0].type = Dart_CObject_kNull;
+  values[1].type = Dart_CObject_kBool;
+  values[1].value.as_bool = true;
+  values[2].type = Dart_CObject_kBool;
+  values[2].value.as_bool = false;
+  values[3].type = Dart_CObject_kInt32;
+  values[3].value.as_int32 = -42;
+  values[4].type = Dart_CObject_kInt64;
+  values[4].value.as_int64 = kSmiMax;
+  for (intptr_t i = 0; i < 5; i++) {
+    std::unique_ptr<Message> message = WriteApiMessage(
+        scope.zone(), &values[i], ILLEGAL_PORT, Message::kNormalPriority);
+    EXPECT(message->IsRaw());
+    // kSmiMax may be read back as kInt32 when Smis are 31 bits.
+    if (i < 4) CheckEncodeDecodeMessage(scope.zone(), &values[i]);
+  }
+
+  const Object& obj = Object::Handle(ReadMessage(
+      thread, WriteApiMessage(scope.zone(), &values[4], ILLEGAL_PORT,
+                              Message::kNormalPriority)
+                  .get()));
+  EXPECT(obj.IsSmi());
+  EXPECT_EQ(kSmiMax, Smi::Cast(obj).Value());
+
+  // Integers outside of Smi range still need a Mint and are serialized.
+  Dart_CObject mint;
+  mint.type = Dart_CObject_kInt64;
+  mint.value.as_int64 = kMaxInt64;
+  std::unique_ptr<Message> message = WriteApiMessage(
+      scope.zone(), &mint, ILLEGAL_PORT, Message::kNormalPriority);
+  EXPECT(message->IsSnapshot());
+  CheckEncodeDecodeMessage(scope.zone(), &mint);
+}
+
+ISOLATE_UNIT_TEST_CASE(SerializeApiFlatValues) {
+  StackZone zone(thread);
+  ApiNativeScope scope;
+
+  uint8_t bytes[] = {1, 2, 3, 4};
+  Dart_CObject string;
+  string.type = Dart_CObject_kString;
+  string.value.as_string = "Blåbærgrød";
+  Dart_CObject typed_data;
+  typed_data.type = Dart_CObject_kTypedData;
+  typed_data.value.as_typed_data.type = Dart_TypedData_kUint8;
+  typed_data.value.as_typed_data.length = ARRAY_SIZE(bytes);
+  typed_data.value.as_typed_data.values = bytes;
+  Dart_CObject mint;
+  mint.type = Dart_CObject_kInt64;
+  mint.value.as_int64 = kMaxInt64;
+  Dart_CObject dbl;
+  dbl.type = Dart_CObject_kDouble;
+  dbl.value.as_double = 3.14;
+  Dart_CObject null;
+  null.type = Dart_CObject_kNull;
+  Dart_CObject* elements[] = {&string, &typed_data, &mint, &dbl, &null};
+  Dart_CObject array;
+  array.type = Dart_CObject_kArray;
+  array.value.as_array.length = ARRAY_SIZE(elements);
+  array.value.as_array.values = elements;
+
+  Dart_CObject* roots[] = {&string, &typed_data, &mint, &dbl, &array};
+  for (Dart_CObject* root : roots) {
+    CheckEncodeDecodeMessage(scope.zone(), root);
+  }
+
+  const Array& result = Array::Handle(Array::RawCast(ReadMessage(
+      thread, WriteApiMessage(scope.zone(), &array, ILLEGAL_PORT,
+                              Message::kNormalPriority)
+                  .get())));
+  EXPECT_EQ(ARRAY_SIZE(elements), result.Length());
+  Object& element = Object::Handle();
+  element = result.At(0);
+  EXPECT(element.IsString());
+  EXPECT_STREQ("Blåbærgrød", String::Cast(element).ToCString());
+  element = result.At(1);
+  EXPECT(element.IsTypedData());
+  EXPECT_EQ(kTypedDataUint8ArrayCid, element.GetClassId());
+  EXPECT_EQ(4, TypedData::Cast(element).Length());
+  EXPECT_EQ(4, TypedData::Cast(element).GetUint8(3));
+  element = result.At(2);
+  EXPECT(element.IsMint());
+  EXPECT_EQ(kMaxInt64, Mint::Cast(element).Value());
+  element = result.At(3);
+  EXPECT(element.IsDouble());
+  EXPECT_EQ(3.14, Double::Cast(element).value());
+  EXPECT(result.At(4) == Object::null());
+
+  // Strings and typed data that appear twice keep their identity, which the
+  // flat encoding cannot express.
+  Dart_CObject* shared[] = {&string, &string};
+  array.value.as_array.length = ARRAY_SIZE(shared);
+  array.value.as_array.values = shared;
+  const Array& shared_result = Array::Handle(Array::RawCast(ReadMessage(
+      thread, WriteApiMessage(scope.zone(), &array, ILLEGAL_PORT,
+                              Message::kNormalPriority)
+                  .get())));
+  EXPECT_EQ(2, shared_result.Length());
+  EXPECT(shared_result.At(0) == shared_result.At(1));
+  CheckEncodeDecodeMessage(scope.zone(), &array);
+
+  // Invalid UTF-8 is rejected as before.
+  string.value.as_string = "\xff";
+  ExpectEncodeFail(scope.zone(), &string);
+}
+
 ISOLATE_UNIT_TEST_CASE(SerializeTrue) {
   StackZone zone(thread);
 
@@ -573,6 +573,7 @@ class ObjectPointerVisitor;
   V(vm_recognized, "vm:recognized")                                            \
   V(vm_testing_print_flow_graph, "vm:testing:print-flow-graph")                \
   V(vm_trace_entrypoints, "vm:testing.unsafe.trace-entrypoints-fn")            \
+  V(vm_unlikely, "vm:unlikely")                                                \
   V(vm_unsafe_no_interrupts, "vm:unsafe:no-interrupts")                        \
   V(vm_align_loops, "vm:align-loops")                                          \
   V(vm_unsafe_no_bounds_checks, "vm:unsafe:no-bounds-checks")
@@ -19,6 +19,7 @@
 #include "vm/os_thread.h"
 #include "vm/profiler.h"
 #include "vm/runtime_entry.h"
+#include "vm/safepoint_poll_page.h"
 #include "vm/service.h"
 #include "vm/stub_code.h"
 #include "vm/symbols.h"
@@ -78,6 +79,7 @@ Thread::Thread(bool is_vm_isolate)
       double_truncate_round_supported_(
           TargetCPUFeatures::double_truncate_round_supported() ? 1 : 0),
       tsan_utils_(DO_IF_TSAN(new TsanUtils()) DO_IF_NOT_TSAN(nullptr)),
+      safepoint_poll_page_(SafepointPollPage::disarmed_page()),
       task_kind_(kUnknownTask),
 #if defined(SUPPORT_TIMELINE)
       dart_stream_(ASSERT_NOTNULL(Timeline::GetDartStream())),
@@ -388,6 +390,7 @@ void Thread::EnterIsolate(Isolate* isolate) {
 
   isolate->scheduled_mutator_thread_ = thread;
   ResumeDartMutatorThreadInternal(thread);
+  isolate->StartCpuTimeAccounting();
 
   if (is_resumable) {
     // Descheduled isolates are reloadable (if nothing else prevents it).
@@ -427,6 +430,7 @@ void Thread::ExitIsolate(bool isolate_shutdown) {
   auto isolate = thread->isolate();
   auto group = thread->isolate_group();
 
+  isolate->AccountCpuTime();
   thread->set_vm_tag(isolate->is_runnable() ? VMTag::kIdleTagId
                                             : VMTag::kLoadWaitTagId);
   if (thread->sticky_error() != Error::null()) {
@@ -592,6 +596,14 @@ Thread* Thread::AddActiveThread(IsolateGroup* group,
 
   auto thread_registry = group->thread_registry();
   auto safepoint_handler = group->safepoint_handler();
+
+  // Constructing a [Thread] is comparatively expensive, so do it before
+  // taking the lock every other thread entering or leaving the group (and
+  // every safepoint operation) contends on.
+  Thread* spare = thread_registry->IsFreeListEmpty()
+                      ? new Thread(is_vm_isolate)
+                      : nullptr;
+
   MonitorLocker ml(thread_registry->threads_lock());
 
   if (!bypass_safepoint) {
@@ -600,7 +612,7 @@ Thread* Thread::AddActiveThread(IsolateGroup* group,
     }
   }
 
-  Thread* thread = thread_registry->GetFreeThreadLocked(is_vm_isolate);
+  Thread* thread = thread_registry->GetFreeThreadLocked(is_vm_isolate, spare);
   thread->AssertEmptyThreadInvariants();
 
   thread->isolate_ = isolate;  // May be nullptr.
@@ -721,6 +733,22 @@ void Thread::ScheduleInterrupts(uword interrupt_bits) {
       new_limit = (kInterruptStackLimit & ~kInterruptsMask) | interrupt_bits;
     }
   } while (!stack_limit_.compare_exchange_weak(old_limit, new_limit));
+
+  if (SafepointPollPage::armed_page() != 0) {
+    safepoint_poll_page_.store(SafepointPollPage::armed_page());
+  }
+}
+
+void Thread::UpdateSafepointPollPage() {
+  if (SafepointPollPage::armed_page() == 0) return;
+  // Disarm first and re-check: an interrupt scheduled concurrently has either
+  // updated stack_limit_ already (and is seen below) or will arm the page
+  // after we are done. A stale arm only costs one trip through the slow path,
+  // which ends up here again.
+  safepoint_poll_page_.store(SafepointPollPage::disarmed_page());
+  if (IsInterruptLimit(stack_limit_.load())) {
+    safepoint_poll_page_.store(SafepointPollPage::armed_page());
+  }
 }
 
 uword Thread::GetAndClearInterrupts() {
@@ -731,10 +759,12 @@ uword Thread::GetAndClearInterrupts() {
     if (IsInterruptLimit(old_limit)) {
       interrupt_bits = interrupt_bits | (old_limit & kInterruptsMask);
     } else {
+      UpdateSafepointPollPage();
       return interrupt_bits;
     }
   } while (!stack_limit_.compare_exchange_weak(old_limit, new_limit));
 
+  UpdateSafepointPollPage();
   return interrupt_bits;
 }
 
@@ -1496,6 +1526,14 @@ void Thread::ResetDartMutatorState(Isolate* isolate) {
   ONLY_IN_PRECOMPILED(dispatch_table_array_ = nullptr);
 }
 
+void Thread::AccountAllocatedBytes(intptr_t bytes) {
+  // Helper threads of the group (e.g. the background compiler) have no
+  // isolate to charge.
+  if (isolate_ != nullptr) {
+    isolate_->GetAllocatedBytesMetric()->increment_by(bytes);
+  }
+}
+
 #if !defined(PRODUCT)
 DisableThreadInterruptsScope::DisableThreadInterruptsScope(Thread* thread)
     : StackResource(thread) {
@@ -539,6 +539,10 @@ class Thread : public ThreadState {
 
   static intptr_t tsan_utils_offset() { return OFFSET_OF(Thread, tsan_utils_); }
 
+  static intptr_t safepoint_poll_page_offset() {
+    return OFFSET_OF(Thread, safepoint_poll_page_);
+  }
+
 #if defined(USING_THREAD_SANITIZER)
   uword exit_through_ffi() const { return exit_through_ffi_; }
   TsanUtils* tsan_utils() const { return tsan_utils_; }
@@ -1151,6 +1155,10 @@ class Thread : public ThreadState {
   void PrintJSON(JSONStream* stream) const;
 #endif
 
+  // Charges |bytes| allocated by this thread (from a released TLAB or
+  // directly in old space) to its isolate.
+  void AccountAllocatedBytes(intptr_t bytes);
+
 #if !defined(PRODUCT) || defined(FORCE_INCLUDE_SAMPLING_HEAP_PROFILER)
   HeapProfileSampler& heap_sampler() { return heap_sampler_; }
 #endif
@@ -1182,6 +1190,9 @@ class Thread : public ThreadState {
   template <class T>
   T* AllocateReusableHandle();
 
+  // Points safepoint_poll_page_ at the armed page iff interrupts are pending.
+  void UpdateSafepointPollPage();
+
   enum class RestoreWriteBarrierInvariantOp {
     kAddToRememberedSet,
     kAddToDeferredMarkingStack
@@ -1314,6 +1325,10 @@ class Thread : public ThreadState {
 
   TsanUtils* tsan_utils_ = nullptr;
 
+  // Page loaded by loop interrupt checks under --use_safepoint_poll_page.
+  // Points at SafepointPollPage::armed_page() while an interrupt is pending.
+  std::atomic<uword> safepoint_poll_page_;
+
   // ---- End accessed from generated code. ----
 
   // The layout of Thread object up to this point should not depend
@@ -1410,6 +1425,7 @@ class Thread : public ThreadState {
 #endif
 
   Thread* next_;  // Used to chain the thread structures in an isolate.
+  Thread* prev_ = nullptr;  // Back link while on the active list.
   Isolate* scheduled_dart_mutator_isolate_ = nullptr;
 
   bool is_unwind_in_progress_ = false;
@@ -25,9 +25,10 @@ ThreadRegistry::~ThreadRegistry() {
   }
 }
 
-Thread* ThreadRegistry::GetFreeThreadLocked(bool is_vm_isolate) {
+Thread* ThreadRegistry::GetFreeThreadLocked(bool is_vm_isolate,
+                                            Thread* spare) {
   ASSERT(threads_lock()->IsOwnedByCurrentThread());
-  Thread* thread = GetFromFreelistLocked(is_vm_isolate);
+  Thread* thread = GetFromFreelistLocked(is_vm_isolate, spare);
   ASSERT(thread->api_top_scope() == nullptr);
   // Now add this Thread to the active list for the isolate.
   AddToActiveListLocked(thread);
@@ -118,7 +119,11 @@ void ThreadRegistry::FlushMarkingStacks() {
 void ThreadRegistry::AddToActiveListLocked(Thread* thread) {
   ASSERT(thread != nullptr);
   ASSERT(threads_lock()->IsOwnedByCurrentThread());
+  thread->prev_ = nullptr;
   thread->next_ = active_list_;
+  if (active_list_ != nullptr) {
+    active_list_->prev_ = thread;
+  }
   active_list_ = thread;
   active_isolates_count_.fetch_add(1);
 }
@@ -126,32 +131,33 @@ void ThreadRegistry::AddToActiveListLocked(Thread* thread) {
 void ThreadRegistry::RemoveFromActiveListLocked(Thread* thread) {
   ASSERT(thread != nullptr);
   ASSERT(threads_lock()->IsOwnedByCurrentThread());
-  Thread* prev = nullptr;
-  Thread* current = active_list_;
-  while (current != nullptr) {
-    if (current == thread) {
-      if (prev == nullptr) {
-        active_list_ = current->next_;
-      } else {
-        prev->next_ = current->next_;
-      }
-      active_isolates_count_.fetch_sub(1);
-      break;
-    }
-    prev = current;
-    current = current->next_;
+  ASSERT(thread->prev_ != nullptr || active_list_ == thread);
+  if (thread->prev_ == nullptr) {
+    active_list_ = thread->next_;
+  } else {
+    thread->prev_->next_ = thread->next_;
   }
+  if (thread->next_ != nullptr) {
+    thread->next_->prev_ = thread->prev_;
+  }
+  thread->prev_ = nullptr;
+  thread->next_ = nullptr;
+  active_isolates_count_.fetch_sub(1);
 }
 
-Thread* ThreadRegistry::GetFromFreelistLocked(bool is_vm_isolate) {
+Thread* ThreadRegistry::GetFromFreelistLocked(bool is_vm_isolate,
+                                              Thread* spare) {
   ASSERT(threads_lock()->IsOwnedByCurrentThread());
-  Thread* thread = nullptr;
   // Get thread structure from free list or create a new one.
   if (free_list_ == nullptr) {
-    thread = new Thread(is_vm_isolate);
-  } else {
-    thread = free_list_;
-    free_list_ = thread->next_;
+    return spare != nullptr ? spare : new Thread(is_vm_isolate);
+  }
+  Thread* thread = free_list_;
+  free_list_ = thread->next_;
+  free_list_count_.fetch_sub(1);
+  if (spare != nullptr) {
+    // Another thread was returned while the spare was being allocated.
+    ReturnToFreelistLocked(spare);
   }
   return thread;
 }
@@ -167,6 +173,7 @@ void ThreadRegistry::ReturnToFreelistLocked(Thread* thread) {
   // Add thread to the free list.
   thread->next_ = free_list_;
   free_list_ = thread;
+  free_list_count_.fetch_add(1);
 }
 
 }  // namespace dart
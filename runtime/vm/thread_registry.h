@@ -26,6 +26,7 @@ class ThreadRegistry {
       : threads_lock_(),
         active_list_(nullptr),
         free_list_(nullptr),
+        free_list_count_(0),
         active_isolates_count_(0) {}
   ~ThreadRegistry();
 
@@ -51,11 +52,18 @@ class ThreadRegistry {
  private:
   Thread* active_list() const { return active_list_; }
 
-  Thread* GetFreeThreadLocked(bool is_vm_isolate);
+  // Whether the free list is (likely) empty, checked without holding
+  // [threads_lock_] so callers can allocate a [Thread] before taking it.
+  bool IsFreeListEmpty() const { return free_list_count_.load() == 0; }
+
+  // Takes a thread from the free list, falling back to [spare] (allocated
+  // by the caller outside of [threads_lock_]) and only then to a new one.
+  // An unused [spare] is put on the free list.
+  Thread* GetFreeThreadLocked(bool is_vm_isolate, Thread* spare = nullptr);
   void ReturnThreadLocked(Thread* thread);
   void AddToActiveListLocked(Thread* thread);
   void RemoveFromActiveListLocked(Thread* thread);
-  Thread* GetFromFreelistLocked(bool is_vm_isolate);
+  Thread* GetFromFreelistLocked(bool is_vm_isolate, Thread* spare);
   void ReturnToFreelistLocked(Thread* thread);
 
   // This monitor protects the threads list for an isolate, it is used whenever
@@ -63,6 +71,7 @@ class ThreadRegistry {
   mutable Monitor threads_lock_;
   Thread* active_list_;  // List of active threads in the isolate.
   Thread* free_list_;    // Free list of Thread objects that can be reused.
+  RelaxedAtomic<intptr_t> free_list_count_;
   RelaxedAtomic<intptr_t> active_isolates_count_;
 
   friend class Thread;
@@ -18,6 +18,8 @@ class ClassID {
   @pragma("vm:entry-point")
   static final int cidImmutableArray = 0;
   @pragma("vm:entry-point")
+  static final int cidSmi = 0;
+  @pragma("vm:entry-point")
   static final int cidOneByteString = 0;
   @pragma("vm:entry-point")
   static final int cidTwoByteString = 0;
@@ -11,6 +11,8 @@ import "dart:_internal" show patch;
 
 import "dart:async" show Future, Zone;
 
+import "dart:ffi" show Int64, Native;
+
 import "dart:isolate" show SendPort;
 
 /// These are the additional parts of this patch library:
@@ -705,13 +705,24 @@ final class _Smi extends _IntegerImplementation {
   static String _negativeToString(int negSmi) {
     // Character code for '-'
     const int MINUS_SIGN = 0x2d;
-    // Character code for '0'.
-    const int DIGIT_ZERO = 0x30;
     // Number of digits, not including minus.
     int digitCount = _negativeBase10Length(negSmi);
     _OneByteString result = _OneByteString._allocate(digitCount + 1);
     result._setAt(0, MINUS_SIGN); // '-'.
-    int index = digitCount;
+    _writeNegativeDigits(result, digitCount, negSmi);
+    return result;
+  }
+
+  // Writes the decimal digits of [negSmi], which must be <= -100, into
+  // [result] so that the last digit is at [index].
+  // Also used for negated mints, which are not smis.
+  static void _writeNegativeDigits(
+    _OneByteString result,
+    int index,
+    int negSmi,
+  ) {
+    // Character code for '0'.
+    const int DIGIT_ZERO = 0x30;
     do {
       int twoDigits = unsafeCast<int>(negSmi.remainder(100));
       negSmi = negSmi ~/ 100;
@@ -728,7 +739,6 @@ final class _Smi extends _IntegerImplementation {
       result._setAt(index, _digitTable[digitIndex + 1]);
       result._setAt(index - 1, _digitTable[digitIndex]);
     }
-    return result;
   }
 }
 
@@ -749,4 +759,16 @@ final class _Mint extends _IntegerImplementation {
   @pragma("vm:exact-result-type", "dart:core#_Smi")
   @pragma("vm:external-name", "Mint_bitLength")
   external int get bitLength;
+
+  // Formats two digits at a time directly into the result string, like
+  // [_Smi.toString], instead of going through a C string in the runtime.
+  String toString() {
+    if (this < 0) return _Smi._negativeToString(this);
+    // Negating a positive value never overflows.
+    final int negValue = -this;
+    final int length = _Smi._negativeBase10Length(negValue);
+    final _OneByteString result = _OneByteString._allocate(length);
+    _Smi._writeNegativeDigits(result, length - 1, negValue);
+    return result;
+  }
 }
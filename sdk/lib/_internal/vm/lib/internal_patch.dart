@@ -194,6 +194,11 @@ abstract class VMInternalsForTesting {
   // to a known stub.
   @pragma("vm:external-name", "Internal_allocateObjectInstructionsEnd")
   external static int allocateObjectInstructionsEnd();
+
+  // Number of interrupt checks in loops which were taken through a fault on
+  // the protected safepoint poll page (see --use_safepoint_poll_page).
+  @pragma("vm:external-name", "Internal_safepointPollFaultCount")
+  external static int safepointPollFaultCount();
 }
 
 @patch
@@ -463,6 +468,30 @@ class FinalizerEntry {
 @pragma("vm:external-name", "StringBase_intern")
 external String intern(String str);
 
+// hashCode and == of keys in the default LinkedHashMap and LinkedHashSet.
+//
+// Strings and small integers are the most common keys. Comparing the class
+// id with a constant makes the compiler redefine the key with that exact
+// class in the guarded branch (see FlowGraphTypePropagator::VisitBranch), so
+// the cached string hash, the Smi value and the matching equality are used
+// directly. Only other keys go through a dynamic call.
+// See runtime/tests/vm/dart/default_hash_code_and_equals_il_test.dart.
+@pragma("vm:prefer-inline")
+int defaultHashCode(Object? e) {
+  final int cid = ClassID.getID(e);
+  if (cid == ClassID.cidOneByteString) return e.hashCode;
+  if (cid == ClassID.cidSmi) return e.hashCode;
+  return e.hashCode;
+}
+
+@pragma("vm:prefer-inline")
+bool defaultEquals(Object? e1, Object? e2) {
+  final int cid = ClassID.getID(e1);
+  if (cid == ClassID.cidOneByteString) return e1 == e2;
+  if (cid == ClassID.cidSmi) return e1 == e2;
+  return e1 == e2;
+}
+
 @patch
 Future<Object?> loadDynamicModule({Uri? uri, Uint8List? bytes}) {
   try {
@@ -13,11 +13,11 @@ class Stopwatch {
 
   // Returns the current clock tick.
   @patch
-  @pragma("vm:external-name", "Stopwatch_now")
+  @Native<Int64 Function()>(symbol: "Stopwatch_now", isLeaf: true)
   external static int _now();
 
   // Returns the frequency of clock ticks in Hz.
-  @pragma("vm:external-name", "Stopwatch_frequency")
+  @Native<Int64 Function()>(symbol: "Stopwatch_frequency", isLeaf: true)
   external static int _computeFrequency();
 
   @patch
@@ -1296,7 +1296,12 @@ final class _OneByteString extends _StringBase {
       "\xc0\xc1\xc2\xc3\xc4\xc5\xc6\xc7\xc8\xc9\xca\xcb\xcc\xcd\xce\xcf"
       "\xd0\xd1\xd2\xd3\xd4\xd5\xd6\xf7\xd8\xd9\xda\xdb\xdc\xdd\xde\x00";
 
+  // Strings longer than this are case mapped by the runtime, which checks and
+  // converts ASCII text several code units at a time.
+  static const int _nativeCaseMappingThreshold = 64;
+
   String toLowerCase() {
+    if (this.length > _nativeCaseMappingThreshold) return super.toLowerCase();
     for (int i = 0; i < this.length; i++) {
       final c = this.codeUnitAt(i);
       if (c == _LC_TABLE.codeUnitAt(c)) continue;
@@ -1314,6 +1319,7 @@ final class _OneByteString extends _StringBase {
   }
 
   String toUpperCase() {
+    if (this.length > _nativeCaseMappingThreshold) return super.toUpperCase();
     for (int i = 0; i < this.length; i++) {
       final c = this.codeUnitAt(i);
       // Continue loop if character is unchanged by upper-case conversion.
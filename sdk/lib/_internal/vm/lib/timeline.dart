@@ -9,7 +9,7 @@ part of "developer.dart";
 external bool _isDartStreamEnabled();
 
 @patch
-@pragma("vm:external-name", "Timeline_getTraceClock")
+@Native<Int64 Function()>(symbol: "Timeline_getTraceClock", isLeaf: true)
 external int _getTraceClock();
 
 @patch
@@ -172,10 +172,82 @@ class _BigIntImpl implements BigInt {
     return result;
   }
 
+  /// Number of decimal characters above which [_parseDecimal] splits the
+  /// input in halves instead of accumulating it 9 digits at a time.
+  static const int _parseDecimalDivideAndConquerThreshold = 9 * 32;
+
+  /// Powers of ten used by [_parseDecimalDivideAndConquer], extended on
+  /// demand and kept across calls.
+  ///
+  /// `_decimalPowers[k] == 10^(_parseDecimalDivideAndConquerThreshold << k)`.
+  static final List<_BigIntImpl> _decimalPowers = <_BigIntImpl>[
+    new _BigIntImpl._fromInt(10).pow(_parseDecimalDivideAndConquerThreshold),
+  ];
+
   /// Parses a decimal bigint literal.
   ///
   /// The [source] must not contain leading or trailing whitespace.
   static _BigIntImpl _parseDecimal(String source, bool isNegative) {
+    _BigIntImpl result;
+    if (source.length <= _parseDecimalDivideAndConquerThreshold) {
+      result = _parseDecimalRange(source, 0, source.length);
+    } else {
+      final powers = _decimalPowers;
+      while ((_parseDecimalDivideAndConquerThreshold << powers.length) <
+          source.length) {
+        powers.add(powers.last * powers.last);
+      }
+      result = _parseDecimalDivideAndConquer(
+        source,
+        0,
+        source.length,
+        powers,
+        powers.length - 1,
+      );
+    }
+    if (isNegative) return -result;
+    return result;
+  }
+
+  /// Parses `source.substring(start, end)` as `high * 10^n + low`, where the
+  /// length `n` of the low part is the largest
+  /// `_parseDecimalDivideAndConquerThreshold << level` shorter than the input.
+  ///
+  /// With Karatsuba multiplication this is subquadratic, while the sequential
+  /// loop in [_parseDecimalRange] is quadratic in the length of the input.
+  static _BigIntImpl _parseDecimalDivideAndConquer(
+    String source,
+    int start,
+    int end,
+    List<_BigIntImpl> powers,
+    int level,
+  ) {
+    if (end - start <= _parseDecimalDivideAndConquerThreshold) {
+      return _parseDecimalRange(source, start, end);
+    }
+    while ((_parseDecimalDivideAndConquerThreshold << level) >= end - start) {
+      level--;
+    }
+    final split = end - (_parseDecimalDivideAndConquerThreshold << level);
+    final high = _parseDecimalDivideAndConquer(
+      source,
+      start,
+      split,
+      powers,
+      level,
+    );
+    final low = _parseDecimalDivideAndConquer(
+      source,
+      split,
+      end,
+      powers,
+      level - 1,
+    );
+    return high * powers[level] + low;
+  }
+
+  /// Parses the decimal digits `source.substring(start, end)`.
+  static _BigIntImpl _parseDecimalRange(String source, int start, int end) {
     const _0 = 48;
 
     int part = 0;
@@ -183,9 +255,9 @@ class _BigIntImpl implements BigInt {
     // Read in the source 9 digits at a time.
     // The first part may have a few leading virtual '0's to make the remaining
     // parts all have exactly 9 digits.
-    int digitInPartCount = 9 - unsafeCast<int>(source.length.remainder(9));
+    int digitInPartCount = 9 - unsafeCast<int>((end - start).remainder(9));
     if (digitInPartCount == 9) digitInPartCount = 0;
-    for (int i = 0; i < source.length; i++) {
+    for (int i = start; i < end; i++) {
       part = part * 10 + source.codeUnitAt(i) - _0;
       if (++digitInPartCount == 9) {
         result = result * _oneBillion + new _BigIntImpl._fromInt(part);
@@ -193,7 +265,6 @@ class _BigIntImpl implements BigInt {
         digitInPartCount = 0;
       }
     }
-    if (isNegative) return -result;
     return result;
   }
 
@@ -1275,6 +1346,10 @@ class _BigIntImpl implements BigInt {
     if (used == 0 || otherUsed == 0) {
       return zero;
     }
+    if (used >= _karatsubaThreshold && otherUsed >= _karatsubaThreshold) {
+      final product = _absMulKaratsuba(this, other);
+      return _isNegative != other._isNegative ? -product : product;
+    }
     var resultUsed = used + otherUsed;
     var digits = _digits;
     var otherDigits = other._digits;
@@ -1290,6 +1365,57 @@ class _BigIntImpl implements BigInt {
     );
   }
 
+  /// Minimal number of digits of both operands for which multiplication
+  /// switches from the schoolbook algorithm to Karatsuba.
+  ///
+  /// Below this size the (intrinsified) quadratic [_mulAdd] loop is faster
+  /// than the extra additions and allocations of the recursive algorithm.
+  static const int _karatsubaThreshold = 40;
+
+  /// Returns the non-negative big integer made of `digits[from..to-1]`.
+  static _BigIntImpl _digitRange(Uint32List digits, int from, int to) {
+    final used = to - from;
+    if (used <= 0) return zero;
+    return new _BigIntImpl._(false, used, _cloneDigits(digits, from, to, used));
+  }
+
+  /// Returns `abs(x) * abs(y)` using Karatsuba multiplication.
+  ///
+  /// Operands are split in a low and a high half of `half` digits each, so that
+  /// `x*y = z2*B^(2*half) + z1*B^half + z0` with
+  /// `z1 = (x0 + x1)*(y0 + y1) - z0 - z2`, trading one of the four half-size
+  /// products for a few linear-time additions.
+  static _BigIntImpl _absMulKaratsuba(_BigIntImpl x, _BigIntImpl y) {
+    if (x._used < y._used) {
+      final tmp = x;
+      x = y;
+      y = tmp;
+    }
+    final xUsed = x._used;
+    final yUsed = y._used;
+    if (yUsed < _karatsubaThreshold) {
+      if (yUsed == 0) return zero;
+      final resultUsed = xUsed + yUsed;
+      final resultDigits = _newDigits(resultUsed);
+      _mulDigits(x._digits, xUsed, y._digits, yUsed, resultDigits);
+      return new _BigIntImpl._(false, resultUsed, resultDigits);
+    }
+    final half = (xUsed + 1) >> 1;
+    final x0 = _digitRange(x._digits, 0, half);
+    final x1 = _digitRange(x._digits, half, xUsed);
+    if (yUsed <= half) {
+      // Unbalanced operands: only split the larger one.
+      return _absMulKaratsuba(x1, y)._dlShift(half) +
+          _absMulKaratsuba(x0, y);
+    }
+    final y0 = _digitRange(y._digits, 0, half);
+    final y1 = _digitRange(y._digits, half, yUsed);
+    final z0 = _absMulKaratsuba(x0, y0);
+    final z2 = _absMulKaratsuba(x1, y1);
+    final z1 = _absMulKaratsuba(x0 + x1, y0 + y1) - z0 - z2;
+    return z2._dlShift(2 * half) + z1._dlShift(half) + z0;
+  }
+
   // resultDigits[0..resultUsed-1] =
   //     xDigits[0..xUsed-1]*otherDigits[0..otherUsed-1].
   // Returns resultUsed = xUsed + otherUsed.
@@ -327,8 +327,11 @@ abstract class _EqualsAndHashCode {
 }
 
 mixin _OperatorEqualsAndHashCode implements _EqualsAndHashCode {
-  int _hashCode(Object? e) => e.hashCode;
-  bool _equals(Object? e1, Object? e2) => e1 == e2;
+  @pragma("vm:prefer-inline")
+  int _hashCode(Object? e) => internal.defaultHashCode(e);
+
+  @pragma("vm:prefer-inline")
+  bool _equals(Object? e1, Object? e2) => internal.defaultEquals(e1, e2);
 }
 
 mixin _IdenticalAndIdentityHashCode implements _EqualsAndHashCode {
@@ -171,4 +171,55 @@ main() {
     "d87becaa3701c97b31b5b8084f2b5b34e7857092",
   );
   expectProduct("-d87becaa3701c97b31b5b8084f2b5b34e7857092", "-0", "0");
+
+  testLargeProducts();
+}
+
+// Products of operands large enough to use Karatsuba multiplication, checked
+// against results that are computed without large multiplications.
+testLargeProducts() {
+  for (final bits in [1000, 1500, 2048, 4096, 8192, 20000]) {
+    // (2^n - 1) * (2^m - 1) == 2^(n + m) - 2^n - 2^m + 1.
+    for (final otherBits in [bits, bits ~/ 2 + 100, bits - 32, bits + 31]) {
+      final a = (BigInt.one << bits) - BigInt.one;
+      final b = (BigInt.one << otherBits) - BigInt.one;
+      final expected =
+          (BigInt.one << (bits + otherBits)) -
+          (BigInt.one << bits) -
+          (BigInt.one << otherBits) +
+          BigInt.one;
+      Expect.equals(expected, a * b);
+      Expect.equals(expected, b * a);
+      Expect.equals(-expected, -a * b);
+      Expect.equals(expected, -a * -b);
+    }
+
+    // Multiply by a pseudo-random operand, one 32-bit digit at a time.
+    var a = BigInt.parse(
+      "d87becaa3701c97b31b5b8084f2b5b34e7857092",
+      radix: 16,
+    );
+    var b = BigInt.parse(
+      "d4cba13fac3ee22b996ff6856c27c1f6d88aef0e",
+      radix: 16,
+    );
+    while (a.bitLength < bits) {
+      a = (a << 97) ^ (a * b);
+    }
+    while (b.bitLength < bits ~/ 2 * 3) {
+      b = (b << 61) ^ (b * b);
+    }
+    var expected = BigInt.zero;
+    final mask = (BigInt.one << 32) - BigInt.one;
+    for (var shift = 0; shift < b.bitLength; shift += 32) {
+      expected += (a * ((b >> shift) & mask)) << shift;
+    }
+    Expect.equals(expected, a * b);
+    Expect.equals(expected, b * a);
+    Expect.equals(a * a - b * b, (a + b) * (a - b));
+
+    // Large decimal strings are parsed by splitting them in halves.
+    Expect.equals(expected, BigInt.parse(expected.toString()));
+    Expect.equals(-expected, BigInt.parse((-expected).toString()));
+  }
 }